@@ -0,0 +1,187 @@
+#include "GraphGenerator.hpp"
+
+namespace graphGenerator {
+    std::uint64_t Random::next() {
+        std::uint64_t z = (this->state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        
+        return z ^ (z >> 31);
+    }
+    
+    void TextWriter::begin(std::size_t numVertices, std::size_t numEdges) {
+        std::fprintf(this->output, "%zu %zu\n", numVertices, numEdges);
+    }
+    
+    void TextWriter::write(std::size_t from, std::size_t to, int weight) {
+        std::fprintf(this->output, "%zu %zu %d\n", from, to, weight);
+    }
+    
+    void TextWriter::end() {
+        std::fprintf(this->output, "0 0\n");
+    }
+    
+    void StationTextWriter::begin(std::size_t numVertices, std::size_t numEdges) {
+        std::fprintf(this->output, "%zu %zu\n", numVertices, numEdges);
+        
+        for (std::size_t i = 0; i < numVertices; i++) {
+            std::fprintf(this->output, i + 1 < numVertices ? "s%zu " : "s%zu\n", i);
+        }
+    }
+    
+    void StationTextWriter::write(std::size_t from, std::size_t to, int weight) {
+        std::fprintf(this->output, "s%zu s%zu %d\n", from, to, weight);
+    }
+    
+    void StationTextWriter::end() {
+        std::fprintf(this->output, "s0\n0 0\n");
+    }
+    
+    void BinaryWriter::begin(std::size_t numVertices, std::size_t numEdges) {
+        std::int64_t header[2] = {
+            static_cast<std::int64_t>(numVertices),
+            static_cast<std::int64_t>(numEdges)
+        };
+        
+        std::fwrite(header, sizeof(std::int64_t), 2, this->output);
+    }
+    
+    void BinaryWriter::write(std::size_t from, std::size_t to, int weight) {
+        std::int32_t record[3] = {
+            static_cast<std::int32_t>(from),
+            static_cast<std::int32_t>(to),
+            static_cast<std::int32_t>(weight)
+        };
+        
+        std::fwrite(record, sizeof(std::int32_t), 3, this->output);
+    }
+    
+    void BinaryWriter::end() {
+        std::fflush(this->output);
+    }
+    
+    /**
+     * Draws a weight in the range [1, maxWeight].
+     */
+    static int randomWeight(int maxWeight, Random &random) {
+        return 1 + static_cast<int>(random.below(maxWeight));
+    }
+    
+    void randomGraph(std::size_t numVertices, std::size_t numEdges,
+                     int maxWeight, Random &random, EdgeWriter &writer) {
+        writer.begin(numVertices, numEdges);
+        
+        for (std::size_t i = 0; i < numEdges; i++) {
+            std::size_t from = random.below(numVertices);
+            std::size_t to = random.below(numVertices - 1);
+            
+            // Skip the origin vertex, so self-loops never happen.
+            if (to >= from) {
+                to++;
+            }
+            
+            writer.write(from, to, randomWeight(maxWeight, random));
+        }
+        
+        writer.end();
+    }
+    
+    void gridGraph(std::size_t rows, std::size_t columns,
+                   int maxWeight, Random &random, EdgeWriter &writer) {
+        writer.begin(rows * columns, 2 * rows * columns - rows - columns);
+        
+        for (std::size_t i = 0; i < rows; i++) {
+            for (std::size_t j = 0; j < columns; j++) {
+                std::size_t vertex = i * columns + j;
+                
+                if (j + 1 < columns) {
+                    writer.write(vertex, vertex + 1, randomWeight(maxWeight, random));
+                }
+                
+                if (i + 1 < rows) {
+                    writer.write(vertex, vertex + columns, randomWeight(maxWeight, random));
+                }
+            }
+        }
+        
+        writer.end();
+    }
+    
+    void completeGraph(std::size_t numVertices,
+                       int maxWeight, Random &random, EdgeWriter &writer) {
+        writer.begin(numVertices, numVertices * (numVertices - 1) / 2);
+        
+        for (std::size_t i = 0; i < numVertices; i++) {
+            for (std::size_t j = i + 1; j < numVertices; j++) {
+                writer.write(i, j, randomWeight(maxWeight, random));
+            }
+        }
+        
+        writer.end();
+    }
+    
+    void rmatGraph(unsigned scale, std::size_t numEdges,
+                   int maxWeight, Random &random, EdgeWriter &writer) {
+        // Cumulative quadrant probabilities (0.57, 0.19, 0.19, 0.05)
+        // scaled to 2^32, so that the draws don't use floating point.
+        const std::uint64_t a = 2448131359ULL;
+        const std::uint64_t ab = a + 816043786ULL;
+        const std::uint64_t abc = ab + 816043786ULL;
+        
+        writer.begin(static_cast<std::size_t>(1) << scale, numEdges);
+        
+        std::size_t written = 0;
+        while (written < numEdges) {
+            std::size_t from = 0, to = 0;
+            
+            for (unsigned level = 0; level < scale; level++) {
+                std::uint64_t draw = random.next() >> 32;
+                
+                from <<= 1;
+                to <<= 1;
+                if (draw >= abc) {
+                    from |= 1;
+                    to |= 1;
+                } else if (draw >= ab) {
+                    from |= 1;
+                } else if (draw >= a) {
+                    to |= 1;
+                }
+            }
+            
+            if (from != to) {
+                writer.write(from, to, randomWeight(maxWeight, random));
+                written++;
+            }
+        }
+        
+        writer.end();
+    }
+    
+    void adversarialGraph(std::size_t numVertices,
+                          int maxWeight, Random &random, EdgeWriter &writer) {
+        const std::size_t cliqueSize = (numVertices + 1) / 2;
+        const std::size_t numEdges = cliqueSize * (cliqueSize - 1) / 2
+                                   + (numVertices - cliqueSize);
+        const int lightWeight = maxWeight / 2;
+        
+        writer.begin(numVertices, numEdges);
+        
+        // Light clique: every weight is below the path weights, and
+        // only cliqueSize - 1 of its edges belong to the MST.
+        for (std::size_t i = 0; i < cliqueSize; i++) {
+            for (std::size_t j = i + 1; j < cliqueSize; j++) {
+                writer.write(i, j, randomWeight(lightWeight, random));
+            }
+        }
+        
+        // Heavy path from the clique to the last vertex: every one of
+        // its edges belongs to the MST, but only after all the clique
+        // edges have been examined.
+        for (std::size_t i = cliqueSize; i < numVertices; i++) {
+            writer.write(i - 1, i, lightWeight + randomWeight(maxWeight - lightWeight, random));
+        }
+        
+        writer.end();
+    }
+}
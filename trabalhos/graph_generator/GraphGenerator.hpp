@@ -0,0 +1,195 @@
+#ifndef GRAPH_GENERATOR_HPP_
+#define GRAPH_GENERATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace graphGenerator {
+    /**
+     * Seeded pseudo-random number generator (SplitMix64). Unlike the
+     * standard distributions, its output doesn't depend on the standard
+     * library implementation, so a seed always yields the same graph.
+     */
+    class Random {
+    public:
+        /**
+         * Constructor with single parameter that sets the seed.
+         * 
+         * @param std::uint64_t Seed
+         */
+        explicit Random(std::uint64_t seed) : state(seed) {}
+        
+        /**
+         * Returns the next 64-bit pseudo-random number.
+         * 
+         * @return std::uint64_t Pseudo-random number
+         */
+        std::uint64_t next();
+        
+        /**
+         * Returns a pseudo-random number in the range [0, bound).
+         * 
+         * @param std::uint64_t Upper bound (exclusive), greater than zero
+         * @return std::uint64_t Pseudo-random number
+         */
+        std::uint64_t below(std::uint64_t bound) {
+            return this->next() % bound;
+        }
+        
+    private:
+        std::uint64_t state;
+    };
+    
+    /**
+     * Destination of the generated edges. Edges are streamed one at
+     * a time, so graphs with hundreds of millions of edges are never
+     * held in memory.
+     */
+    class EdgeWriter {
+    public:
+        virtual ~EdgeWriter() {}
+        
+        /**
+         * Starts a new graph.
+         * 
+         * @param std::size_t Number of vertices
+         * @param std::size_t Number of edges that will be written
+         */
+        virtual void begin(std::size_t numVertices, std::size_t numEdges) = 0;
+        
+        /**
+         * Writes an undirected edge.
+         * 
+         * @param std::size_t Origin vertex
+         * @param std::size_t Destination vertex
+         * @param int Weight
+         */
+        virtual void write(std::size_t from, std::size_t to, int weight) = 0;
+        
+        /**
+         * Finishes the graph.
+         */
+        virtual void end() = 0;
+    };
+    
+    /**
+     * Writes the text format read by the uva_11857 driver: a line with
+     * the number of vertices and edges, one "from to weight" line per
+     * edge and a final "0 0" line.
+     */
+    class TextWriter : public EdgeWriter {
+    public:
+        explicit TextWriter(std::FILE *output) : output(output) {}
+        
+        void begin(std::size_t numVertices, std::size_t numEdges);
+        void write(std::size_t from, std::size_t to, int weight);
+        void end();
+        
+    private:
+        std::FILE *output;
+    };
+    
+    /**
+     * Writes the text format read by the uva_11710 driver, where the
+     * vertices are station names ("s0", "s1", ...) listed after the
+     * header and followed by the edges and the start station.
+     */
+    class StationTextWriter : public EdgeWriter {
+    public:
+        explicit StationTextWriter(std::FILE *output) : output(output) {}
+        
+        void begin(std::size_t numVertices, std::size_t numEdges);
+        void write(std::size_t from, std::size_t to, int weight);
+        void end();
+        
+    private:
+        std::FILE *output;
+    };
+    
+    /**
+     * Writes a binary format: the number of vertices and the number of
+     * edges as 64-bit integers, followed by one (from, to, weight)
+     * record of 32-bit integers per edge, in native byte order.
+     */
+    class BinaryWriter : public EdgeWriter {
+    public:
+        explicit BinaryWriter(std::FILE *output) : output(output) {}
+        
+        void begin(std::size_t numVertices, std::size_t numEdges);
+        void write(std::size_t from, std::size_t to, int weight);
+        void end();
+        
+    private:
+        std::FILE *output;
+    };
+    
+    /**
+     * Random multigraph G(n, m): m edges whose endpoints are chosen
+     * uniformly at random, without self-loops.
+     * 
+     * @param std::size_t Number of vertices (at least 2)
+     * @param std::size_t Number of edges
+     * @param int Maximum weight (weights are in [1, maxWeight])
+     * @param Random& Random number generator
+     * @param EdgeWriter& Destination of the edges
+     */
+    void randomGraph(std::size_t numVertices, std::size_t numEdges,
+                     int maxWeight, Random &random, EdgeWriter &writer);
+    
+    /**
+     * Road-like grid graph: every vertex is connected to its right and
+     * bottom neighbours.
+     * 
+     * @param std::size_t Number of rows
+     * @param std::size_t Number of columns
+     * @param int Maximum weight (weights are in [1, maxWeight])
+     * @param Random& Random number generator
+     * @param EdgeWriter& Destination of the edges
+     */
+    void gridGraph(std::size_t rows, std::size_t columns,
+                   int maxWeight, Random &random, EdgeWriter &writer);
+    
+    /**
+     * Complete graph with random weights.
+     * 
+     * @param std::size_t Number of vertices
+     * @param int Maximum weight (weights are in [1, maxWeight])
+     * @param Random& Random number generator
+     * @param EdgeWriter& Destination of the edges
+     */
+    void completeGraph(std::size_t numVertices,
+                       int maxWeight, Random &random, EdgeWriter &writer);
+    
+    /**
+     * Power-law graph generated by the R-MAT recursive matrix model
+     * with probabilities (0.57, 0.19, 0.19, 0.05). Self-loops are
+     * discarded and drawn again.
+     * 
+     * @param unsigned Scale (the graph has 2^scale vertices)
+     * @param std::size_t Number of edges
+     * @param int Maximum weight (weights are in [1, maxWeight])
+     * @param Random& Random number generator
+     * @param EdgeWriter& Destination of the edges
+     */
+    void rmatGraph(unsigned scale, std::size_t numEdges,
+                   int maxWeight, Random &random, EdgeWriter &writer);
+    
+    /**
+     * Adversarial graph for Kruskal's algorithm: a light clique over
+     * half of the vertices, whose edges mostly close cycles, and a
+     * path over the other half whose edges are the heaviest ones. The
+     * MST is only complete after almost every edge has been examined,
+     * so Kruskal's early stop never helps and the whole edge set has
+     * to be sorted.
+     * 
+     * @param std::size_t Number of vertices (at least 2)
+     * @param int Maximum weight (at least 2)
+     * @param Random& Random number generator
+     * @param EdgeWriter& Destination of the edges
+     */
+    void adversarialGraph(std::size_t numVertices,
+                          int maxWeight, Random &random, EdgeWriter &writer);
+}
+
+#endif
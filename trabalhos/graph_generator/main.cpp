@@ -0,0 +1,99 @@
+#include "GraphGenerator.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+/**
+ * Prints how the generator must be called.
+ */
+static void usage(const char *program) {
+    std::fprintf(stderr,
+        "usage: %s <generator> <format> <seed> <output> <params...>\n"
+        "\n"
+        "generators:\n"
+        "    gnm <vertices> <edges> <max weight>\n"
+        "    grid <rows> <columns> <max weight>\n"
+        "    complete <vertices> <max weight>\n"
+        "    rmat <scale> <edges> <max weight>\n"
+        "    adversarial <vertices> <max weight>\n"
+        "\n"
+        "formats: text (uva_11857), stations (uva_11710), binary\n"
+        "output: file path, or - for the standard output\n",
+        program);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 6) {
+        usage(argv[0]);
+        return 1;
+    }
+    
+    std::string generator = argv[1];
+    std::string format = argv[2];
+    graphGenerator::Random random(std::strtoull(argv[3], NULL, 10));
+    
+    std::size_t numParams = argc - 5;
+    unsigned long long params[3] = {0, 0, 0};
+    for (std::size_t i = 0; i < numParams && i < 3; i++) {
+        params[i] = std::strtoull(argv[5 + i], NULL, 10);
+    }
+    
+    const bool twoParams = generator == "complete" || generator == "adversarial";
+    if (numParams != (twoParams ? 2u : 3u)) {
+        usage(argv[0]);
+        return 1;
+    }
+    
+    const int maxWeight = static_cast<int>(params[numParams - 1]);
+    if (maxWeight < (generator == "adversarial" ? 2 : 1)) {
+        std::fprintf(stderr, "invalid maximum weight\n");
+        return 1;
+    }
+    
+    const bool toStdout = std::strcmp(argv[4], "-") == 0;
+    std::FILE *output = toStdout ? stdout : std::fopen(argv[4], "wb");
+    if (output == NULL) {
+        std::perror(argv[4]);
+        return 1;
+    }
+    
+    graphGenerator::TextWriter textWriter(output);
+    graphGenerator::StationTextWriter stationWriter(output);
+    graphGenerator::BinaryWriter binaryWriter(output);
+    graphGenerator::EdgeWriter *writer = NULL;
+    
+    if (format == "text") {
+        writer = &textWriter;
+    } else if (format == "stations") {
+        writer = &stationWriter;
+    } else if (format == "binary") {
+        writer = &binaryWriter;
+    }
+    
+    int status = 0;
+    if (writer == NULL) {
+        usage(argv[0]);
+        status = 1;
+    } else if (generator == "gnm" && params[0] >= 2) {
+        graphGenerator::randomGraph(params[0], params[1], maxWeight, random, *writer);
+    } else if (generator == "grid" && params[0] >= 1 && params[1] >= 1) {
+        graphGenerator::gridGraph(params[0], params[1], maxWeight, random, *writer);
+    } else if (generator == "complete" && params[0] >= 1) {
+        graphGenerator::completeGraph(params[0], maxWeight, random, *writer);
+    } else if (generator == "rmat" && params[0] >= 1 && params[0] < 32) {
+        graphGenerator::rmatGraph(params[0], params[1], maxWeight, random, *writer);
+    } else if (generator == "adversarial" && params[0] >= 2) {
+        graphGenerator::adversarialGraph(params[0], maxWeight, random, *writer);
+    } else {
+        usage(argv[0]);
+        status = 1;
+    }
+    
+    if (!toStdout) {
+        std::fclose(output);
+    }
+    
+    return status;
+}
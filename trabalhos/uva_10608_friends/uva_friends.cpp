@@ -1,41 +1,54 @@
 #include <iostream>
-#include "DisjointSet.h"
+#include <limits>
+#include <utility>
+#include <vector>
+#include "DisjointSet.hpp"
 
 using namespace std;
 
+/**
+ * Reads the pairs of a test and returns the size of the largest group
+ * of friends, using Index as the element type of the union-find.
+ */
+template <typename Index>
+size_t largestGroup(unsigned numCitizens, unsigned numPairs) {
+    disjointSet::BasicDisjointSet<Index, disjointSet::BY_SIZE> set(numCitizens);
+    vector<pair<Index, Index>> pairs(numPairs);
+
+    for (unsigned j = 0; j < numPairs; j++) {
+        unsigned firstPerson = 0;
+        unsigned secondPerson = 0;
+
+        cin >> firstPerson;
+        cin >> secondPerson;
+
+        pairs[j] = make_pair(static_cast<Index>(firstPerson - 1), static_cast<Index>(secondPerson - 1));
+    }
+
+    return set.mergeBatch(pairs.begin(), pairs.end());
+}
+
 int main()  {
     //freopen("input.in", "r", stdin);
     //freopen("output.out", "w", stdout);
 
-    unsigned short numTests = 0;
+    unsigned numTests = 0;
 
     cin >> numTests;
-    for (unsigned short i = 0; i < numTests; i++) {
-        unsigned short numCitizens = 0;
-        unsigned short numPairs = 0;
-        unsigned short maxGroup = 1;
+    for (unsigned i = 0; i < numTests; i++) {
+        unsigned numCitizens = 0;
+        unsigned numPairs = 0;
 
         cin >> numCitizens;
         cin >> numPairs;
 
-        DisjointSet set(numCitizens);
-
-        for (unsigned short j = 0; j < numPairs; j++) {
-            auto firstPerson = static_cast<unsigned short>(-1);
-            auto secondPerson = static_cast<unsigned short>(-1);
-
-            cin >> firstPerson;
-            cin >> secondPerson;
-
-            firstPerson--;
-            secondPerson--;
-
-            unsigned short sizeGroup = set.merge(firstPerson, secondPerson);
-            maxGroup = max(maxGroup, sizeGroup);
+        // 16-bit elements while they fit, 32-bit otherwise.
+        if (numCitizens <= numeric_limits<unsigned short>::max()) {
+            cout << largestGroup<unsigned short>(numCitizens, numPairs) << endl;
+        } else {
+            cout << largestGroup<unsigned>(numCitizens, numPairs) << endl;
         }
-
-        cout << maxGroup << endl;
     }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,150 @@
+#ifndef EDGE_PIPELINE_HPP_
+#define EDGE_PIPELINE_HPP_
+
+#include "Graph.hpp"
+#include "SPSCQueue.hpp"
+
+#include <cstddef>
+#include <istream>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace graph {
+    // Number of edges parsed before a chunk is handed to the builder.
+    const std::size_t PIPELINE_CHUNK_SIZE = 4096;
+    
+    // Maximum number of chunks waiting in the queue.
+    const std::size_t PIPELINE_QUEUE_SIZE = 8;
+    
+    // A chunk of parsed edges: the edge itself (weight and destination
+    // vertex) and its origin vertex.
+    typedef std::vector<std::pair<Edge, int>> EdgeChunk;
+    
+    /**
+     * Parser of "from to weight" lines with integer vertices.
+     */
+    class IndexEdgeParser {
+    public:
+        bool operator ()(std::istream &input, std::pair<Edge, int> &edge) const {
+            return static_cast<bool>(input >> edge.second >> edge.first.second >> edge.first.first);
+        }
+    };
+    
+    /**
+     * Parser of "from to weight" lines with named vertices, such as
+     * the stations of uva_11710. Unknown names get vertex 0, as
+     * std::map::operator[] does in the sequential driver.
+     */
+    class NamedEdgeParser {
+    public:
+        explicit NamedEdgeParser(const std::map<std::string, int> &names)
+                : names(names) {}
+        
+        bool operator ()(std::istream &input, std::pair<Edge, int> &edge) {
+            if (!(input >> this->from >> this->to >> edge.first.first)) {
+                return false;
+            }
+            
+            edge.second = this->lookup(this->from);
+            edge.first.second = this->lookup(this->to);
+            return true;
+        }
+        
+    private:
+        const std::map<std::string, int> &names;
+        std::string from, to;
+        
+        int lookup(const std::string &name) const {
+            std::map<std::string, int>::const_iterator it = this->names.find(name);
+            return it == this->names.end() ? 0 : it->second;
+        }
+    };
+    
+    /**
+     * Reads numEdges edges with the given parser and appends them to
+     * the sink (a Graph or a GraphBuilder). Parsing runs on its own
+     * thread, handing chunks of parsed edges to the calling thread
+     * through a bounded lock-free queue, so that the load time gets
+     * close to the largest of the parse and build times instead of
+     * their sum. Small inputs, that wouldn't fill two chunks, are read
+     * sequentially to avoid the cost of starting a thread.
+     * 
+     * The input is only read by the parser thread, which has finished
+     * by the time this function returns.
+     * 
+     * @param std::istream& Stream the edges are read from
+     * @param std::size_t Number of edges to be read
+     * @param Parser Parser of a single edge
+     * @param Sink& Graph or builder the edges are appended to
+     */
+    template <typename Parser, typename Sink>
+    void pipelinedLoad(std::istream &input, std::size_t numEdges, Parser parse, Sink &sink) {
+        std::pair<Edge, int> edge;
+        
+        if (numEdges < 2 * PIPELINE_CHUNK_SIZE) {
+            for (std::size_t i = 0; i < numEdges && parse(input, edge); i++) {
+                sink.appendEdge(edge.second, edge.first);
+            }
+            
+            return;
+        }
+        
+        SPSCQueue<EdgeChunk> queue(PIPELINE_QUEUE_SIZE);
+        
+        // An empty chunk marks the end of the input.
+        std::thread parser([&input, numEdges, &parse, &queue]() {
+            EdgeChunk chunk;
+            std::pair<Edge, int> parsed;
+            std::size_t remaining = numEdges;
+            
+            do {
+                chunk.clear();
+                while (chunk.size() < PIPELINE_CHUNK_SIZE && remaining > 0 && parse(input, parsed)) {
+                    chunk.push_back(parsed);
+                    remaining--;
+                }
+                
+                // Stop early if the input ended before numEdges.
+                if (chunk.size() < PIPELINE_CHUNK_SIZE) {
+                    remaining = 0;
+                }
+                
+                const bool last = chunk.empty();
+                while (!queue.tryPush(chunk)) {
+                    std::this_thread::yield();
+                }
+                
+                if (!last && remaining == 0) {
+                    chunk.clear();
+                    while (!queue.tryPush(chunk)) {
+                        std::this_thread::yield();
+                    }
+                }
+            } while (remaining > 0);
+        });
+        
+        EdgeChunk chunk;
+        while (true) {
+            if (!queue.tryPop(chunk)) {
+                std::this_thread::yield();
+                continue;
+            }
+            
+            if (chunk.empty()) {
+                break;
+            }
+            
+            const std::size_t chunkSize = chunk.size();
+            for (std::size_t i = 0; i < chunkSize; i++) {
+                sink.appendEdge(chunk[i].second, chunk[i].first);
+            }
+        }
+        
+        parser.join();
+    }
+}
+
+#endif
@@ -0,0 +1,369 @@
+#include "DisjointSet.hpp"
+#include "ExternalKruskal.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+namespace graph {
+    // The first element of the pair is also a pair containing the weight
+    // of the edge and the destination vertex. The second element is the
+    // source vertex (same layout used by Graph::kruskalMST).
+    typedef std::pair<Edge, int> SourcedEdge;
+    
+    // Most runs merged at once. Each merged run needs a buffer of its
+    // own, so this caps the number of buffers the memory is split in.
+    static const std::size_t MAX_FAN_IN = 512;
+    
+    /**
+     * Temporary file holding consecutive sorted runs of edges, each
+     * edge as three ints. A whole merge pass uses a single file, so
+     * the number of open files doesn't grow with the number of runs.
+     */
+    class RunFile {
+    public:
+        // Edge index where each run starts; the last two elements are
+        // where the run being written starts and ends.
+        std::vector<std::size_t> offsets;
+        
+        RunFile() : offsets(2, 0), file(std::tmpfile()) {
+            if (this->file == NULL) {
+                throw std::runtime_error("could not create temporary run file");
+            }
+        }
+        
+        ~RunFile() {
+            std::fclose(this->file);
+        }
+        
+        /**
+         * Appends edges to the run being written.
+         * 
+         * @param const int* Edges, three ints each
+         * @param std::size_t Number of edges
+         */
+        void write(const int *raw, std::size_t numEdges) {
+            if (std::fseek(this->file, 0, SEEK_END) != 0 ||
+                    std::fwrite(raw, 3 * sizeof(int), numEdges, this->file) != numEdges) {
+                throw std::runtime_error("could not write temporary run file");
+            }
+            
+            this->offsets.back() += numEdges;
+        }
+        
+        /**
+         * Ends the run being written and starts a new one.
+         */
+        void endRun() {
+            this->offsets.push_back(this->offsets.back());
+        }
+        
+        /**
+         * Returns the number of finished runs.
+         * 
+         * @return std::size_t Number of runs
+         */
+        std::size_t numRuns() const {
+            return this->offsets.size() - 2;
+        }
+        
+        /**
+         * Reads edges starting at an edge index.
+         * 
+         * @param int* Filled with the edges, three ints each
+         * @param std::size_t Index of the first edge
+         * @param std::size_t Number of edges
+         * @return std::size_t Number of edges read
+         */
+        std::size_t read(int *raw, std::size_t position, std::size_t numEdges) {
+            if (std::fseek(this->file, static_cast<long>(position * 3 * sizeof(int)), SEEK_SET) != 0) {
+                throw std::runtime_error("could not read temporary run file");
+            }
+            
+            return std::fread(raw, 3 * sizeof(int), numEdges, this->file);
+        }
+    
+    private:
+        std::FILE *file;
+        
+        RunFile(const RunFile &);
+        RunFile &operator =(const RunFile &);
+    };
+    
+    /**
+     * Sequential reader of a run of a RunFile, buffering a fixed
+     * number of edges at a time.
+     */
+    class RunReader {
+    public:
+        RunReader(RunFile &runs, std::size_t run, std::size_t bufferSize)
+                : runs(runs), next(runs.offsets[run]), end(runs.offsets[run + 1]),
+                  buffer(3 * bufferSize), position(0), loaded(0) {}
+        
+        /**
+         * Reads the next edge of the run.
+         * 
+         * @param SourcedEdge& Filled with the next edge
+         * @return bool False if the run is exhausted
+         */
+        bool read(SourcedEdge &edge) {
+            if (this->position == this->loaded) {
+                std::size_t count = std::min(this->buffer.size() / 3, this->end - this->next);
+                if (count == 0) {
+                    return false;
+                }
+                
+                if (this->runs.read(&this->buffer[0], this->next, count) != count) {
+                    throw std::runtime_error("could not read temporary run file");
+                }
+                
+                this->next += count;
+                this->loaded = 3 * count;
+                this->position = 0;
+            }
+            
+            edge.first.first = this->buffer[this->position++];
+            edge.first.second = this->buffer[this->position++];
+            edge.second = this->buffer[this->position++];
+            return true;
+        }
+    
+    private:
+        RunFile &runs;
+        std::size_t next;
+        std::size_t end;
+        std::vector<int> buffer;
+        std::size_t position;
+        std::size_t loaded;
+    };
+    
+    /**
+     * Buffered writer of a new run at the end of a RunFile.
+     */
+    class RunWriter {
+    public:
+        RunWriter(RunFile &runs, std::size_t bufferSize)
+                : runs(runs), buffer(3 * bufferSize), position(0) {}
+        
+        /**
+         * Appends an edge to the run.
+         * 
+         * @param const SourcedEdge& The edge
+         * @return bool Always true: every edge is wanted
+         */
+        bool operator ()(const SourcedEdge &edge) {
+            if (this->position == this->buffer.size()) {
+                flush();
+            }
+            
+            this->buffer[this->position++] = edge.first.first;
+            this->buffer[this->position++] = edge.first.second;
+            this->buffer[this->position++] = edge.second;
+            return true;
+        }
+        
+        /**
+         * Writes the buffered edges and ends the run.
+         */
+        void endRun() {
+            flush();
+            this->runs.endRun();
+        }
+    
+    private:
+        RunFile &runs;
+        std::vector<int> buffer;
+        std::size_t position;
+        
+        void flush() {
+            if (this->position > 0) {
+                this->runs.write(&this->buffer[0], this->position / 3);
+                this->position = 0;
+            }
+        }
+    };
+    
+    /**
+     * Kruskal's algorithm fed with edges in nondecreasing order.
+     */
+    class KruskalSink {
+    public:
+        KruskalSink(Graph &mst, std::size_t numVertices)
+                : mst(mst), disjointSet(numVertices), numVertices(numVertices), numEdges(0) {}
+        
+        /**
+         * Takes the edge if it joins two trees.
+         * 
+         * @param const SourcedEdge& The edge
+         * @return bool False once the tree is complete
+         */
+        bool operator ()(const SourcedEdge &edge) {
+            int srcRoot = this->disjointSet.find(edge.second);
+            int destRoot = this->disjointSet.find(edge.first.second);
+            
+            if (srcRoot != destRoot) {
+                this->mst.appendEdge(edge.second, std::make_pair(edge.first.first, edge.first.second));
+                this->disjointSet.merge(srcRoot, destRoot);
+                this->numEdges++;
+            }
+            
+            return this->numEdges + 1 < this->numVertices;
+        }
+    
+    private:
+        Graph &mst;
+        disjointSet::DisjointSet disjointSet;
+        std::size_t numVertices;
+        std::size_t numEdges;
+    };
+    
+    /**
+     * Sorts the buffered edges and writes them as a new run.
+     * 
+     * @param LargeVector<SourcedEdge>& Edges of the run
+     * @param RunFile& File the run is appended to
+     * @param std::size_t Edges written at a time
+     */
+    static void spillRun(LargeVector<SourcedEdge> &edges, RunFile &runs, std::size_t bufferSize) {
+        std::sort(edges.begin(), edges.end());
+        
+        RunWriter writer(runs, bufferSize);
+        const std::size_t numEdges = edges.size();
+        for (std::size_t i = 0; i < numEdges; i++) {
+            writer(edges[i]);
+        }
+        
+        writer.endRun();
+        edges.clear();
+    }
+    
+    /**
+     * K-way merge of the runs [firstRun, lastRun) of a file, feeding
+     * the edges in order to the sink until it returns false. The heap
+     * holds the current smallest edge of each run, paired with the
+     * run index.
+     */
+    template <typename Sink>
+    static void mergeRuns(RunFile &runs, std::size_t firstRun, std::size_t lastRun,
+                          std::size_t runBuffer, Sink &sink) {
+        std::vector<std::unique_ptr<RunReader>> readers;
+        for (std::size_t run = firstRun; run < lastRun; run++) {
+            readers.push_back(std::unique_ptr<RunReader>(new RunReader(runs, run, runBuffer)));
+        }
+        
+        std::priority_queue<
+            std::pair<SourcedEdge, std::size_t>,
+            std::vector<std::pair<SourcedEdge, std::size_t>>,
+            std::greater<std::pair<SourcedEdge, std::size_t>>
+        > minHeap;
+        
+        SourcedEdge edge;
+        for (std::size_t i = 0; i < readers.size(); i++) {
+            if (readers[i]->read(edge)) {
+                minHeap.push(std::make_pair(edge, i));
+            }
+        }
+        
+        while (!minHeap.empty()) {
+            edge = minHeap.top().first;
+            std::size_t run = minHeap.top().second;
+            minHeap.pop();
+            
+            if (!sink(edge)) {
+                return;
+            }
+            
+            if (readers[run]->read(edge)) {
+                minHeap.push(std::make_pair(edge, run));
+            }
+        }
+    }
+    
+    Graph externalKruskalMST(std::istream &input, std::size_t numVertices,
+                             std::size_t numEdges, std::size_t bufferSize) {
+        bufferSize = std::max<std::size_t>(bufferSize, 1);
+        
+        // Runs are merged fanIn at a time, each reader (and the writer
+        // of the merged run) buffering a share of the memory.
+        const std::size_t fanIn = std::max<std::size_t>(std::min(bufferSize, MAX_FAN_IN), 2);
+        const std::size_t runBuffer = std::max<std::size_t>(bufferSize / (fanIn + 1), 1);
+        
+        LargeVector<SourcedEdge> edges;
+        edges.reserve(std::min(bufferSize, numEdges));
+        std::unique_ptr<RunFile> runs;
+        
+        // 1st phase: read the input, spilling a sorted run every time
+        // the buffer gets full.
+        for (std::size_t i = 0; i < numEdges; i++) {
+            int from, to, weight;
+            
+            if (!(input >> from >> to >> weight)) {
+                throw std::runtime_error("could not read edge from input");
+            }
+            
+            if (from < 0 || static_cast<std::size_t>(from) >= numVertices ||
+                    to < 0 || static_cast<std::size_t>(to) >= numVertices) {
+                throw std::runtime_error("edge vertex out of range");
+            }
+            
+            edges.push_back(std::make_pair(std::make_pair(weight, to), from));
+            
+            if (edges.size() == bufferSize && i + 1 < numEdges) {
+                if (!runs) {
+                    runs.reset(new RunFile());
+                }
+                
+                spillRun(edges, *runs, runBuffer);
+            }
+        }
+        
+        Graph mst(numVertices, false);
+        if (numVertices < 2) {
+            return mst;
+        }
+        
+        KruskalSink kruskal(mst, numVertices);
+        
+        // Without runs the whole edge set fits in memory.
+        if (!runs) {
+            std::sort(edges.begin(), edges.end());
+            
+            const std::size_t totalEdges = edges.size();
+            for (std::size_t i = 0; i < totalEdges && kruskal(edges[i]); i++) {
+            }
+            
+            return mst;
+        }
+        
+        if (!edges.empty()) {
+            spillRun(edges, *runs, runBuffer);
+        }
+        
+        // Release the sorting buffer before merging, its memory is now
+        // split among the run readers.
+        LargeVector<SourcedEdge>().swap(edges);
+        
+        // 2nd phase: while there are more runs than the fan-in, merge
+        // groups of them into longer runs of a new file.
+        while (runs->numRuns() > fanIn) {
+            std::unique_ptr<RunFile> merged(new RunFile());
+            
+            for (std::size_t run = 0; run < runs->numRuns(); run += fanIn) {
+                RunWriter writer(*merged, runBuffer);
+                mergeRuns(*runs, run, std::min(run + fanIn, runs->numRuns()), runBuffer, writer);
+                writer.endRun();
+            }
+            
+            runs.swap(merged);
+        }
+        
+        // 3rd phase: the last merge feeds Kruskal's algorithm.
+        mergeRuns(*runs, 0, runs->numRuns(), runBuffer, kruskal);
+        
+        return mst;
+    }
+}
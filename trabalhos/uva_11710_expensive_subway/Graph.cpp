@@ -1,10 +1,10 @@
 #include "DisjointSet.hpp"
 #include "Graph.hpp"
+#include "GraphAlgorithms.hpp"
 
 #include <algorithm>
-#include <queue>
-#include <set>
-#include <stack>
+#include <functional>
+#include <utility>
 
 namespace graph {
     Graph::Graph(std::size_t size, bool isDirected) 
@@ -12,10 +12,19 @@ namespace graph {
         this->isDirected = isDirected;
     }
     
-    Graph::Graph(std::vector<AdjacentEdges> adjacencyList, bool isDirected) {
-        this->adjacencyList = adjacencyList;
+    Graph::Graph(std::vector<AdjacentEdges> adjacencyList, bool isDirected)
+            : adjacencyList(std::move(adjacencyList)) {
         this->isDirected = isDirected;
     }
+    
+    void Graph::reset(std::size_t size) {
+        const std::size_t kept = std::min(size, this->size());
+        for (std::size_t i = 0; i < kept; i++) {
+            this->adjacencyList[i].clear();
+        }
+        
+        this->adjacencyList.resize(size);
+    }
 
     void Graph::appendEdge(int vertex, Edge edge) {
         this->adjacencyList[vertex].push_back(edge);
@@ -26,110 +35,78 @@ namespace graph {
         }
     }
 
-    std::vector<bool> Graph::dfs(Vertex start) const {
-        std::vector<bool> visited(this->size());
-        std::stack<Vertex> stack;
-        
-        // Push start vertex
-        stack.push(start);
-        
-        // While stack isn't empty, pop a vertex and
-        // verify if it has already been visited. 
-        // If wasn't: 
-        // 1st: mark as visited
-        // 2nd: run into all the edges conected to this vertex and
-        // push all the adjacent vertices to stack.
-        while (!stack.empty()) {
-            Vertex v = stack.top();
-            stack.pop();
-            
-            if (!visited[v.first]) {
-                visited[v.first] = true;
-                
-                AdjacentEdges list = v.second;
-                const std::size_t listSize = list.size();
-                for (size_t i = 0; i < listSize; i++) {
-                    Vertex u = std::make_pair(
-                        list[i].second, 
-                        this->adjacencyList[list[i].second]
-                    );
-                        
-                    stack.push(u);
-                }
-            }
-        }
-        
-        return visited;
+    std::size_t Graph::bfs(int start, LargeVector<bool> &visited) const {
+        return breadthFirstSearch(*this, this->isDirected, start, visited);
     }
 
     bool Graph::isConnected() const {
-        bool isConnected = true;
-        Vertex start = std::make_pair(0, this->adjacencyList[0]);
-        std::vector<bool> visited = this->dfs(start);
-        const std::size_t visitedSize = visited.size();
-        
-        for (size_t i = 0; i < visitedSize && isConnected; i++) {
-            if (!visited[i]) {
-                isConnected = false;
-            }
+        if (this->size() == 0) {
+            return true;
         }
         
-        return isConnected;
+        LargeVector<bool> visited;
+        return this->bfs(0, visited) == this->size();
     }
     
     Graph Graph::kruskalMST() const {
-        const std::size_t graphSize = this->size();
+        Graph mst(0, false);
+        MSTWorkspace workspace;
+        this->kruskalMST(mst, workspace);
         
+        return mst;
+    }
+    
+    void Graph::kruskalMST(Graph &mst, MSTWorkspace &workspace) const {
         // Initialize MST as an undirected graph because
         // both Prim and Kruskal algorithms works for undirected graphs.
-        Graph mst(graphSize, false);
+        mst.reset(this->size());
+        mst.isDirected = false;
         
-        // The first element of the pair is also a pair
-        // containing the weight of the edge and the destination vertex.
-        // The second element is the source vertex.
-        std::vector<std::pair<Edge, int>> edges;
+        kruskalSpanningTree(*this, mst, workspace.edges, workspace.disjointSet);
+    }
 
+    void Graph::collectEdges(EdgeList &edges) const {
+        const std::size_t graphSize = this->size();
+        
         for (std::size_t i = 0; i < graphSize; i++) {
-            AdjacentEdges adj = this->adjacencyList[i];
+            const AdjacentEdges &adj = this->adjacencyList[i];
             const std::size_t numEdges = adj.size();
             
             for (std::size_t j = 0; j < numEdges; j++) {
-                edges.push_back(std::make_pair(adj[j], i));
+                const std::size_t to = adj[j].second;
+                
+                if (to != i && (this->isDirected || i < to)) {
+                    edges.push_back(std::make_pair(adj[j], i));
+                }
             }
         }
-
-        std::sort(edges.begin(), edges.end());
+    }
+    
+    Graph Graph::lazyKruskalMST() const {
+        const std::size_t graphSize = this->size();
+        Graph mst(graphSize, false);
+        
+        EdgeList edges;
+        this->collectEdges(edges);
+        
+        // Min-heap built in O(E); each extraction costs O(log E).
+        std::greater<std::pair<Edge, int>> compare;
+        std::make_heap(edges.begin(), edges.end(), compare);
         
-        // Create subsets for union-find data structure.
         disjointSet::DisjointSet disjointSet(graphSize);
-    
-        // An auxiliary variable to count the number of edges already inserted
-        // into MST.
         std::size_t numEdges = 0;
-
-        // An auxiliary index to the current smaller edge and total number of edges.
-        std::size_t smallerEdge = 0;
-        std::size_t totalEdges = edges.size();
-
-        // The number of edges that MST will contain is the number of vertices
-        // of the graph minus one.
-        while (smallerEdge < totalEdges && numEdges < graphSize - 1) {
-
-            // The current smallest edge.
-            std::pair<Edge, int> nextEdge = edges[smallerEdge++];
+        
+        while (!edges.empty() && numEdges + 1 < graphSize) {
+            std::pop_heap(edges.begin(), edges.end(), compare);
+            std::pair<Edge, int> nextEdge = edges.back();
+            edges.pop_back();
             
-            // Representative elements for source and destination vertices.
             int srcRoot = disjointSet.find(nextEdge.second);
             int destRoot = disjointSet.find(nextEdge.first.second);
             
-            // If including this edge does't cause cycle,
-            // include it in MST and increment the index for 
-            // next edge.
-            // PS: A cycle is found if both vertices are
-            // already in the same set.
             if (srcRoot != destRoot) {
                 Edge edge = std::make_pair(nextEdge.first.first, nextEdge.second);
-                mst.appendEdge(nextEdge.second, edge);
+                mst.appendEdge(nextEdge.first.second, edge);
                 
                 disjointSet.merge(srcRoot, destRoot);
                 numEdges++;
@@ -138,56 +115,297 @@ namespace graph {
         
         return mst;
     }
-
+    
+    SpanningForest Graph::minimumSpanningForest() const {
+        const std::size_t graphSize = this->size();
+        SpanningForest result(graphSize);
+        
+        EdgeList edges;
+        this->collectEdges(edges);
+        
+        std::sort(edges.begin(), edges.end());
+        const std::size_t totalEdges = edges.size();
+        
+        // Position of the last sorted edge touching each component
+        // (kept at its representative). A component whose last edge has
+        // already been examined can't be merged anymore ("closed").
+        std::vector<std::size_t> lastEdge(graphSize, 0);
+        std::vector<bool> hasEdges(graphSize, false);
+        for (std::size_t i = 0; i < totalEdges; i++) {
+            lastEdge[edges[i].second] = i;
+            lastEdge[edges[i].first.second] = i;
+            hasEdges[edges[i].second] = true;
+            hasEdges[edges[i].first.second] = true;
+        }
+        
+        std::size_t openComponents = 0;
+        for (std::size_t i = 0; i < graphSize; i++) {
+            if (hasEdges[i]) {
+                openComponents++;
+            }
+        }
+        
+        disjointSet::DisjointSet disjointSet(graphSize);
+        std::size_t numEdges = 0;
+        
+        // Two open components are needed for another merge to happen.
+        for (std::size_t i = 0; i < totalEdges && openComponents > 1; i++) {
+            const std::pair<Edge, int> &nextEdge = edges[i];
+            
+            int srcRoot = disjointSet.find(nextEdge.second);
+            int destRoot = disjointSet.find(nextEdge.first.second);
+            
+            if (srcRoot != destRoot) {
+                Edge edge = std::make_pair(nextEdge.first.first, nextEdge.second);
+                result.forest.appendEdge(nextEdge.first.second, edge);
+                
+                std::size_t last = std::max(lastEdge[srcRoot], lastEdge[destRoot]);
+                disjointSet.merge(srcRoot, destRoot);
+                srcRoot = disjointSet.find(srcRoot);
+                lastEdge[srcRoot] = last;
+                
+                openComponents--;
+                numEdges++;
+            }
+            
+            if (lastEdge[srcRoot] == i) {
+                openComponents--;
+            }
+        }
+        
+        result.isConnected = numEdges + 1 >= graphSize;
+        
+        // Dense component labels, weights and bottlenecks, all taken
+        // from the union-find and the forest.
+        std::vector<int> label(graphSize, -1);
+        for (std::size_t i = 0; i < graphSize; i++) {
+            int root = disjointSet.find(i);
+            
+            if (label[root] == -1) {
+                label[root] = result.weights.size();
+                result.weights.push_back(0);
+                result.bottlenecks.push_back(0);
+            }
+            
+            int c = label[root];
+            result.component[i] = c;
+            
+            const AdjacentEdges &adj = result.forest[i];
+            const std::size_t numAdj = adj.size();
+            for (std::size_t j = 0; j < numAdj; j++) {
+                // Each tree edge is stored in both of its vertices,
+                // so it's only counted from the smaller one.
+                if (static_cast<std::size_t>(adj[j].second) > i) {
+                    result.weights[c] += adj[j].first;
+                    result.bottlenecks[c] = std::max(result.bottlenecks[c], adj[j].first);
+                }
+            }
+        }
+        
+        return result;
+    }
+    
+    Clustering Graph::clusters(std::size_t k) const {
+        const std::size_t graphSize = this->size();
+        Clustering result;
+        result.hasSpacing = false;
+        result.spacing = 0;
+        
+        EdgeList edges;
+        this->collectEdges(edges);
+        
+        std::sort(edges.begin(), edges.end());
+        
+        disjointSet::DisjointSet disjointSet(graphSize);
+        const std::size_t totalEdges = edges.size();
+        
+        // Merge until k components remain; the first edge that would
+        // still merge two components gives the spacing.
+        for (std::size_t i = 0; i < totalEdges; i++) {
+            int srcRoot = disjointSet.find(edges[i].second);
+            int destRoot = disjointSet.find(edges[i].first.second);
+            
+            if (srcRoot != destRoot) {
+                if (disjointSet.components() <= k) {
+                    result.hasSpacing = true;
+                    result.spacing = edges[i].first.first;
+                    break;
+                }
+                
+                disjointSet.merge(srcRoot, destRoot);
+            }
+        }
+        
+        result.numClusters = disjointSet.components();
+        result.labels.assign(graphSize, -1);
+        
+        std::vector<int> label(graphSize, -1);
+        int nextLabel = 0;
+        for (std::size_t i = 0; i < graphSize; i++) {
+            int root = disjointSet.find(i);
+            
+            if (label[root] == -1) {
+                label[root] = nextLabel++;
+            }
+            
+            result.labels[i] = label[root];
+        }
+        
+        return result;
+    }
+    
     Graph Graph::primMST(int start) const {
+        Graph mst(0, false);
+        MSTWorkspace workspace;
+        this->primMST(start, mst, workspace);
+        
+        return mst;
+    }
+    
+    void Graph::primMST(int start, Graph &mst, MSTWorkspace &workspace) const {
         const std::size_t graphSize = this->size();
         
         // Initialize MST as an undirected graph because
         // both Prim and Kruskal algorithms works for undirected graphs.
-        Graph mst(graphSize, false);
-        std::vector<bool> inMST(graphSize, false);
+        mst.reset(graphSize);
+        mst.isDirected = false;
+        LargeVector<bool> &inMST = workspace.inMST;
+        inMST.assign(graphSize, false);
         std::size_t sizeMST = 0;
         
-        std::priority_queue<
-    	    std::pair<Edge, int>,
-    	    std::vector<std::pair<Edge, int>>,
-    	    std::greater<std::pair<Edge, int>>
-    	> minHeap;
-    	
-    	// Put in the priority queue all the adjacent vertices 
-    	// of the start vertex.
-    	std::size_t numEdges = this->adjacencyList[start].size();
-    	for (size_t i = 0; i < numEdges; i++) {
-    	    minHeap.push(std::make_pair(
-    	        this->adjacencyList[start][i], start)
-    	    );
-    	}
-    	
-    	// While min heap is not empty:
-    	// 1st: Get the smallest edge (the edge with the smallest weight).
-    	// 2nd: Check if at least one of the vertices connected by that
-    	// edge isn't already in the MST (Minimum Spanning Tree).
-    	// 3rd: Put in the priority queue all the adjacent vertices 
-    	// of the destination vertex.
-    	while (!minHeap.empty() && sizeMST < graphSize) {
-    	    graph::Edge edge = minHeap.top().first;
-    	    int from = minHeap.top().second;
-    	    int to = edge.second;
-    	    minHeap.pop();
-    	    
-    	    if (!inMST[from] || !inMST[to]) {
-	            mst.appendEdge(from, edge);
-    	        inMST[from] = true;
-    	        inMST[to] = true;
-    	        sizeMST++;
-    	        
-    	        numEdges = this->adjacencyList[to].size();
-    	        for (size_t i = 0; i < numEdges; i++) {
-    	            minHeap.push(std::make_pair(this->adjacencyList[to][i], to));
-    	        }
-    	    }
-    	}
-    	
-    	return mst;
+        // Min heap kept in the workspace vector, so that its
+        // memory is reused by the next call.
+        EdgeList &minHeap = workspace.edges;
+        std::greater<std::pair<Edge, int>> compare;
+        minHeap.clear();
+        
+        // Put in the priority queue all the adjacent vertices 
+        // of the start vertex.
+        std::size_t numEdges = this->adjacencyList[start].size();
+        for (size_t i = 0; i < numEdges; i++) {
+            minHeap.push_back(std::make_pair(this->adjacencyList[start][i], start));
+            std::push_heap(minHeap.begin(), minHeap.end(), compare);
+        }
+        
+        // While min heap is not empty:
+        // 1st: Get the smallest edge (the edge with the smallest weight).
+        // 2nd: Check if at least one of the vertices connected by that
+        // edge isn't already in the MST (Minimum Spanning Tree).
+        // 3rd: Put in the priority queue all the adjacent vertices 
+        // of the destination vertex.
+        while (!minHeap.empty() && sizeMST < graphSize) {
+            std::pop_heap(minHeap.begin(), minHeap.end(), compare);
+            graph::Edge edge = minHeap.back().first;
+            int from = minHeap.back().second;
+            int to = edge.second;
+            minHeap.pop_back();
+            
+            if (!inMST[from] || !inMST[to]) {
+                mst.appendEdge(from, edge);
+                inMST[from] = true;
+                inMST[to] = true;
+                sizeMST++;
+                
+                numEdges = this->adjacencyList[to].size();
+                for (size_t i = 0; i < numEdges; i++) {
+                    minHeap.push_back(std::make_pair(this->adjacencyList[to][i], to));
+                    std::push_heap(minHeap.begin(), minHeap.end(), compare);
+                }
+            }
+        }
+    }
+    
+    std::vector<int> Graph::vertexOrder(Ordering ordering) const {
+        const std::size_t graphSize = this->size();
+        std::vector<int> order;
+        order.reserve(graphSize);
+        
+        // Candidate start vertices, in the order they are tried.
+        std::vector<int> starts(graphSize);
+        for (std::size_t i = 0; i < graphSize; i++) {
+            starts[i] = i;
+        }
+        
+        const std::vector<AdjacentEdges> &adj = this->adjacencyList;
+        if (ordering == DEGREE_ORDER) {
+            std::stable_sort(starts.begin(), starts.end(), [&adj](int a, int b) {
+                return adj[a].size() > adj[b].size();
+            });
+            
+            return starts;
+        }
+        
+        const bool byDegree = ordering == REVERSE_CUTHILL_MCKEE;
+        if (byDegree) {
+            std::stable_sort(starts.begin(), starts.end(), [&adj](int a, int b) {
+                return adj[a].size() < adj[b].size();
+            });
+        }
+        
+        // Breadth-first search component by component, using the
+        // order vector itself as the queue.
+        std::vector<bool> visited(graphSize, false);
+        std::vector<int> neighbours;
+        for (std::size_t s = 0; s < graphSize; s++) {
+            if (visited[starts[s]]) {
+                continue;
+            }
+            
+            std::size_t head = order.size();
+            visited[starts[s]] = true;
+            order.push_back(starts[s]);
+            
+            while (head < order.size()) {
+                const AdjacentEdges &list = adj[order[head++]];
+                const std::size_t listSize = list.size();
+                
+                neighbours.clear();
+                for (std::size_t i = 0; i < listSize; i++) {
+                    if (!visited[list[i].second]) {
+                        visited[list[i].second] = true;
+                        neighbours.push_back(list[i].second);
+                    }
+                }
+                
+                if (byDegree) {
+                    std::stable_sort(neighbours.begin(), neighbours.end(), [&adj](int a, int b) {
+                        return adj[a].size() < adj[b].size();
+                    });
+                }
+                
+                order.insert(order.end(), neighbours.begin(), neighbours.end());
+            }
+        }
+        
+        if (byDegree) {
+            std::reverse(order.begin(), order.end());
+        }
+        
+        return order;
+    }
+    
+    Graph Graph::relabel(Ordering ordering, std::vector<int> &originalIds) const {
+        const std::size_t graphSize = this->size();
+        originalIds = this->vertexOrder(ordering);
+        
+        std::vector<int> newIds(graphSize);
+        for (std::size_t i = 0; i < graphSize; i++) {
+            newIds[originalIds[i]] = i;
+        }
+        
+        std::vector<AdjacentEdges> adjacencyList(graphSize);
+        for (std::size_t i = 0; i < graphSize; i++) {
+            const AdjacentEdges &list = this->adjacencyList[originalIds[i]];
+            const std::size_t listSize = list.size();
+            
+            adjacencyList[i].reserve(listSize);
+            for (std::size_t j = 0; j < listSize; j++) {
+                adjacencyList[i].push_back(
+                    std::make_pair(list[j].first, newIds[list[j].second])
+                );
+            }
+        }
+        
+        return Graph(std::move(adjacencyList), this->isDirected);
     }
 }
\ No newline at end of file
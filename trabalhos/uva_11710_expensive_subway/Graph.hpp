@@ -1,6 +1,9 @@
 #ifndef GRAPH_HPP_
 #define GRAPH_HPP_
 
+#include "DisjointSet.hpp"
+#include "HugePageAllocator.hpp"
+
 #include <ostream>
 #include <utility>
 #include <vector>
@@ -18,6 +21,29 @@ namespace graph {
     // edges.
     typedef std::pair<int, AdjacentEdges> Vertex;
     
+    // List of edges paired with their source vertex, as sorted by
+    // Kruskal's algorithm.
+    typedef LargeVector<std::pair<Edge, int>> EdgeList;
+    
+    // Strategies used to relabel the vertices of a graph so that
+    // vertices visited together are also stored close together.
+    enum Ordering {
+        // Breadth-first search order, component by component.
+        BFS_ORDER,
+        
+        // Reverse Cuthill-McKee: breadth-first search starting at
+        // a minimum degree vertex, visiting neighbours by increasing
+        // degree, with the resulting order reversed.
+        REVERSE_CUTHILL_MCKEE,
+        
+        // Vertices sorted by decreasing degree.
+        DEGREE_ORDER
+    };
+    
+    struct SpanningForest;
+    struct Clustering;
+    struct MSTWorkspace;
+    
     class Graph {
     public:
         /** 
@@ -32,7 +58,8 @@ namespace graph {
         
         /** 
          * Constructor with single parameter that receives
-         * an already built adjacency list.
+         * an already built adjacency list, which is moved into
+         * the graph (pass it with std::move to avoid a copy).
          * 
          * @param std::vector<AdjacentEdges> Adjacency list
          * @param bool Is a directed graph?
@@ -49,13 +76,38 @@ namespace graph {
          * and destination vertex
          */
         void appendEdge(int vertex, Edge edge);
+        
+        /**
+         * Removes every edge and resizes the graph, keeping the
+         * memory already allocated by the adjacency lists so that
+         * the graph can be refilled without reallocating.
+         * 
+         * @param std::size_t Number of vertices
+         */
+        void reset(std::size_t size);
 
         /**
          * Determines whether a graph is connected or not,
-         * using depth-first search to visit vertices.
+         * using breadth-first search to visit vertices.
          */
         bool isConnected() const;
         
+        /**
+         * Direction-optimizing breadth-first search (Beamer et al.).
+         * Each level is expanded top-down (the frontier looks for
+         * unvisited neighbours) while the frontier is small, and
+         * bottom-up (every unvisited vertex looks for a neighbour in
+         * a bitmap of the frontier) once the frontier gets large, which
+         * skips most edge checks on low-diameter graphs. Directed graphs
+         * are always expanded top-down, since the bottom-up step needs
+         * incoming edges.
+         * 
+         * @param int start vertex
+         * @param LargeVector<bool>& Filled with the visited vertices
+         * @return std::size_t Number of visited vertices
+         */
+        std::size_t bfs(int start, LargeVector<bool> &visited) const;
+        
         /**
          * Builds a minimum spanning tree using Kruskal's algorithm.
          * This algorithm uses a union-find data structure to help
@@ -66,6 +118,58 @@ namespace graph {
          */
         Graph kruskalMST() const;
         
+        /**
+         * Same as kruskalMST(), but writes the minimum spanning tree
+         * into an existing graph and takes its auxiliary buffers from
+         * a workspace. Repeated queries that reuse the same output
+         * graph and workspace don't allocate once they reach their
+         * steady-state sizes.
+         * 
+         * @param Graph& Output minimum spanning tree
+         * @param MSTWorkspace& Reusable auxiliary buffers
+         */
+        void kruskalMST(Graph &mst, MSTWorkspace &workspace) const;
+        
+        /**
+         * Builds a minimum spanning tree using a lazy variant of
+         * Kruskal's algorithm. Instead of sorting every edge up front,
+         * the edges are arranged in a binary min-heap (built in linear
+         * time) and the next lightest edge is only extracted when it's
+         * needed, so the sorting work is proportional to the number of
+         * edges examined before the tree is complete.
+         * 
+         * @return Graph that represents the minimum spanning tree
+         */
+        Graph lazyKruskalMST() const;
+        
+        /**
+         * Builds a minimum spanning forest (a minimum spanning tree
+         * for each connected component) using a single pass of
+         * Kruskal's algorithm, which also tells whether the graph is
+         * connected. This avoids running isConnected() before
+         * kruskalMST().
+         * 
+         * The pass stops as soon as the union-find shows that no more
+         * merges are possible, i.e., at most one component still has
+         * edges left to be examined.
+         * 
+         * @return SpanningForest Forest, per-component weights and
+         * whether the graph is connected
+         */
+        SpanningForest minimumSpanningForest() const;
+        
+        /**
+         * Single-linkage clustering of the vertices in k clusters,
+         * using Kruskal's algorithm stopped as soon as only k
+         * components remain (i.e., the minimum spanning tree without
+         * its k - 1 heaviest edges). The labels and the spacing come
+         * straight from the union-find, no tree is built.
+         * 
+         * @param std::size_t Number of clusters
+         * @return Clustering Cluster of each vertex and spacing
+         */
+        Clustering clusters(std::size_t k) const;
+        
         /**
          * Builds a minimum spanning tree using Prim's algorithm and
          * assuming that this graph is connected.
@@ -75,6 +179,39 @@ namespace graph {
          */
         Graph primMST(int start) const;
         
+        /**
+         * Same as primMST(int), but writes the minimum spanning tree
+         * into an existing graph and takes its auxiliary buffers from
+         * a workspace.
+         * 
+         * @param int Start vertex
+         * @param Graph& Output minimum spanning tree
+         * @param MSTWorkspace& Reusable auxiliary buffers
+         */
+        void primMST(int start, Graph &mst, MSTWorkspace &workspace) const;
+        
+        /**
+         * Computes a permutation of the vertices according to the
+         * given ordering strategy. Position i of the returned vector
+         * holds the original id of the vertex that gets id i.
+         * 
+         * @param Ordering Relabeling strategy
+         * @return std::vector<int> Original ids in their new order
+         */
+        std::vector<int> vertexOrder(Ordering ordering) const;
+        
+        /**
+         * Builds a copy of this graph with its vertices relabeled
+         * according to the given ordering strategy, which improves
+         * memory locality of traversals such as DFS and Prim.
+         * 
+         * @param Ordering Relabeling strategy
+         * @param std::vector<int>& Filled with the original id of
+         * each vertex of the relabeled graph
+         * @return Graph Relabeled graph
+         */
+        Graph relabel(Ordering ordering, std::vector<int> &originalIds) const;
+        
         /**
          * Returns the number of vertices in the graph.
          * 
@@ -100,9 +237,9 @@ namespace graph {
          * this graph in the form of <variable_name[vertex_index]>
          * 
          * @param std::size_t index
-         * @return AdjacentEdges
+         * @return const AdjacentEdges& Reference to the list of adjacent edges
          */
-        AdjacentEdges operator [](std::size_t i) const {
+        const AdjacentEdges &operator [](std::size_t i) const {
             return this->adjacencyList[i];
         }
         
@@ -116,13 +253,78 @@ namespace graph {
         std::vector<AdjacentEdges> adjacencyList;
         
         /**
-         * Iterative depth-first search (using a stack), used
-         * as an auxiliar function to determine whether a
-         * graph is connected or not.
+         * Fills the list with the edges of the graph, in the layout
+         * used by kruskalMST, but undirected edges are only taken once
+         * (from the smaller vertex) and self-loops are dropped, since
+         * they never join two components.
          * 
-         * @param Vertex start vertex
+         * @param EdgeList& Filled with the edges
          */
-        std::vector<bool> dfs(Vertex start) const;
+        void collectEdges(EdgeList &edges) const;
+    };
+    
+    /**
+     * A structure to represent a clustering of the vertices.
+     */
+    struct Clustering {
+        // Cluster of each vertex, numbered from 0 in the order
+        // of their smallest vertex.
+        std::vector<int> labels;
+        
+        // Number of clusters, which is greater than requested if the
+        // graph has more connected components than that.
+        std::size_t numClusters;
+        
+        // Whether some edge joins two different clusters.
+        bool hasSpacing;
+        
+        // Spacing of the clustering: weight of the lightest edge
+        // between two different clusters, only meaningful if
+        // hasSpacing is set (weights may be negative, so no value is
+        // left to mean none).
+        long long spacing;
+    };
+    
+    /**
+     * Auxiliary buffers of the minimum spanning tree algorithms,
+     * kept between calls so that their memory can be reused.
+     */
+    struct MSTWorkspace {
+        // Edges to be sorted (Kruskal) or min heap (Prim).
+        EdgeList edges;
+        
+        // Union-find used by Kruskal.
+        disjointSet::DisjointSet disjointSet;
+        
+        // Vertices already in the tree, used by Prim.
+        LargeVector<bool> inMST;
+        
+        MSTWorkspace() : disjointSet(0) {}
+    };
+    
+    /**
+     * A structure to represent a minimum spanning forest.
+     */
+    struct SpanningForest {
+        // Minimum spanning tree of every connected component.
+        Graph forest;
+        
+        // Component of each vertex, numbered from 0 in the order
+        // of their smallest vertex.
+        std::vector<int> component;
+        
+        // Total weight of the tree of each component.
+        std::vector<long long> weights;
+        
+        // Heaviest edge weight of the tree of each component, or 0
+        // if the component is a single vertex.
+        std::vector<int> bottlenecks;
+        
+        // Whether the graph has a single connected component.
+        bool isConnected;
+        
+        SpanningForest(std::size_t size)
+                : forest(size, false), component(size), isConnected(false) {}
     };
 }
 
@@ -0,0 +1,186 @@
+#ifndef GRAPH_ALGORITHMS_HPP_
+#define GRAPH_ALGORITHMS_HPP_
+
+#include "DisjointSet.hpp"
+#include "Graph.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace graph {
+    /**
+     * Graph algorithms written once for every adjacency container
+     * (Graph, GraphSnapshot, ...). Adjacency must provide size() and
+     * a const operator[] that returns the AdjacentEdges of a vertex.
+     */
+    
+    /**
+     * Direction-optimizing breadth-first search from a vertex (see
+     * Graph::bfs).
+     * 
+     * @param const Adjacency& The graph
+     * @param bool Is a directed graph?
+     * @param int start vertex
+     * @param LargeVector<bool>& Filled with the visited vertices
+     * @return std::size_t Number of visited vertices
+     */
+    template <typename Adjacency>
+    std::size_t breadthFirstSearch(const Adjacency &graph, bool isDirected,
+                                   int start, LargeVector<bool> &visited) {
+        const std::size_t graphSize = graph.size();
+        
+        // Heuristic thresholds from Beamer et al.: switch to bottom-up
+        // when the frontier has more than 1/ALPHA of the unexplored
+        // edges, and back to top-down when it has less than 1/BETA of
+        // the vertices.
+        const std::size_t ALPHA = 14;
+        const std::size_t BETA = 24;
+        
+        visited.assign(graphSize, false);
+        visited[start] = true;
+        std::size_t numVisited = 1;
+        
+        std::size_t unexploredEdges = 0;
+        for (std::size_t i = 0; i < graphSize; i++) {
+            unexploredEdges += graph[i].size();
+        }
+        
+        std::size_t frontierEdges = graph[start].size();
+        unexploredEdges -= frontierEdges;
+        
+        LargeVector<int> frontier(1, start);
+        LargeVector<int> next;
+        LargeVector<bool> inFrontier;
+        bool topDown = true;
+        
+        while (!frontier.empty()) {
+            if (topDown && !isDirected && frontierEdges > unexploredEdges / ALPHA) {
+                topDown = false;
+            } else if (!topDown && frontier.size() < graphSize / BETA) {
+                topDown = true;
+            }
+            
+            next.clear();
+            if (topDown) {
+                const std::size_t frontierSize = frontier.size();
+                for (std::size_t i = 0; i < frontierSize; i++) {
+                    const AdjacentEdges &list = graph[frontier[i]];
+                    const std::size_t listSize = list.size();
+                    
+                    for (std::size_t j = 0; j < listSize; j++) {
+                        if (!visited[list[j].second]) {
+                            visited[list[j].second] = true;
+                            next.push_back(list[j].second);
+                        }
+                    }
+                }
+            } else {
+                inFrontier.assign(graphSize, false);
+                const std::size_t frontierSize = frontier.size();
+                for (std::size_t i = 0; i < frontierSize; i++) {
+                    inFrontier[frontier[i]] = true;
+                }
+                
+                // Every unvisited vertex stops at its first neighbour
+                // found in the frontier.
+                for (std::size_t v = 0; v < graphSize; v++) {
+                    if (visited[v]) {
+                        continue;
+                    }
+                    
+                    const AdjacentEdges &list = graph[v];
+                    const std::size_t listSize = list.size();
+                    for (std::size_t j = 0; j < listSize; j++) {
+                        if (inFrontier[list[j].second]) {
+                            visited[v] = true;
+                            next.push_back(v);
+                            break;
+                        }
+                    }
+                }
+            }
+            
+            frontierEdges = 0;
+            const std::size_t nextSize = next.size();
+            for (std::size_t i = 0; i < nextSize; i++) {
+                frontierEdges += graph[next[i]].size();
+            }
+            
+            unexploredEdges -= std::min(frontierEdges, unexploredEdges);
+            numVisited += nextSize;
+            frontier.swap(next);
+        }
+        
+        return numVisited;
+    }
+    
+    /**
+     * Kruskal's algorithm: appends to mst (already sized and empty)
+     * the edges of a minimum spanning tree, or forest if the graph
+     * isn't connected (see Graph::kruskalMST).
+     * 
+     * @param const Adjacency& The graph
+     * @param Graph& Receives the minimum spanning tree
+     * @param EdgeList& Buffer for the sorted edges
+     * @param disjointSet::DisjointSet& Union-find, reset here
+     */
+    template <typename Adjacency>
+    void kruskalSpanningTree(const Adjacency &graph, Graph &mst, EdgeList &edges,
+                             disjointSet::DisjointSet &disjointSet) {
+        const std::size_t graphSize = graph.size();
+        
+        // The first element of the pair is also a pair
+        // containing the weight of the edge and the destination vertex.
+        // The second element is the source vertex.
+        edges.clear();
+        
+        for (std::size_t i = 0; i < graphSize; i++) {
+            const AdjacentEdges &adj = graph[i];
+            const std::size_t numEdges = adj.size();
+            
+            for (std::size_t j = 0; j < numEdges; j++) {
+                edges.push_back(std::make_pair(adj[j], i));
+            }
+        }
+        
+        std::sort(edges.begin(), edges.end());
+        
+        // Create subsets for union-find data structure.
+        disjointSet.reset(graphSize);
+        
+        // An auxiliary variable to count the number of edges already inserted
+        // into MST.
+        std::size_t numEdges = 0;
+        
+        // An auxiliary index to the current smaller edge and total number of edges.
+        std::size_t smallerEdge = 0;
+        std::size_t totalEdges = edges.size();
+        
+        // The number of edges that MST will contain is the number of vertices
+        // of the graph minus one.
+        while (smallerEdge < totalEdges && numEdges + 1 < graphSize) {
+            
+            // The current smallest edge.
+            const std::pair<Edge, int> &nextEdge = edges[smallerEdge++];
+            
+            // Representative elements for source and destination vertices.
+            int srcRoot = disjointSet.find(nextEdge.second);
+            int destRoot = disjointSet.find(nextEdge.first.second);
+            
+            // If including this edge does't cause cycle,
+            // include it in MST and increment the index for 
+            // next edge.
+            // PS: A cycle is found if both vertices are
+            // already in the same set.
+            if (srcRoot != destRoot) {
+                Edge edge = std::make_pair(nextEdge.first.first, nextEdge.second);
+                mst.appendEdge(nextEdge.first.second, edge);
+                
+                disjointSet.merge(srcRoot, destRoot);
+                numEdges++;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef GRAPH_BATCH_HPP_
+#define GRAPH_BATCH_HPP_
+
+#include "Graph.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace graph {
+    /**
+     * Minimum spanning tree of a case of a batch.
+     */
+    struct BatchResult {
+        // Whether the case has a single connected component.
+        bool isConnected;
+        
+        // Total weight of the minimum spanning tree (or forest).
+        long long weight;
+        
+        // Heaviest edge weight of the tree, or 0 if it has no edges.
+        int bottleneck;
+    };
+    
+    /**
+     * Many small undirected graphs (test cases) packed in a single
+     * arena: the edges of every case are concatenated in one array,
+     * and per-case offsets (as in CSR) tell where the vertices and the
+     * edges of each case start. Solving the whole batch then allocates
+     * a handful of arrays instead of a Graph, a DisjointSet and an edge
+     * vector per case.
+     */
+    class GraphBatch {
+    public:
+        /**
+         * Constructor of an empty batch.
+         * 
+         * @param bool Keep only the lightest of the parallel edges
+         * between each pair of vertices of a case? (optional)
+         */
+        explicit GraphBatch(bool collapseParallelEdges = false)
+                : collapseParallelEdges(collapseParallelEdges),
+                  vertexOffsets(1, 0), edgeOffsets(1, 0) {}
+        
+        /**
+         * Starts a new case; the following edges belong to it.
+         * 
+         * @param std::size_t Number of vertices of the case
+         * @param std::size_t Expected number of edges of the case
+         */
+        void addCase(std::size_t numVertices, std::size_t numEdges = 0);
+        
+        /**
+         * Append an edge to the last case, with vertices numbered
+         * from 0 within the case.
+         * 
+         * @param int Origin vertex
+         * @param Edge Pair formed by weight 
+         * and destination vertex
+         */
+        void appendEdge(int vertex, Edge edge) {
+            this->edges.push_back(std::make_pair(edge, vertex));
+            this->edgeOffsets.back()++;
+        }
+        
+        /**
+         * Returns the number of cases in the batch.
+         * 
+         * @return std::size_t Number of cases
+         */
+        std::size_t size() const {
+            return this->vertexOffsets.size() - 1;
+        }
+        
+    private:
+        friend struct BatchSolver;
+        friend std::vector<BatchResult> solveBatch(GraphBatch &batch, unsigned numThreads);
+        
+        bool collapseParallelEdges;
+        
+        // Where the vertices and the edges of each case start; the
+        // last element of each vector is the total.
+        std::vector<std::size_t> vertexOffsets;
+        std::vector<std::size_t> edgeOffsets;
+        
+        // Edges of every case: the edge itself (weight and destination
+        // vertex) and its origin vertex.
+        EdgeList edges;
+    };
+    
+    /**
+     * Solves the minimum spanning tree and the connectivity of every
+     * case of a batch with Kruskal's algorithm, sweeping the arena
+     * case by case. The cases are split among threads in contiguous
+     * ranges; each range is solved with a union-find of its own, over
+     * the vertices of its cases only, and the results keep the case
+     * order.
+     * 
+     * The edges of each case are sorted in place; if the batch
+     * collapses parallel edges, they are deduplicated first (see
+     * removeParallelEdges), which may also reorder and flip them.
+     * 
+     * @param GraphBatch& Batch of cases
+     * @param unsigned Number of threads
+     * @return std::vector<BatchResult> Result of each case, in order
+     */
+    std::vector<BatchResult> solveBatch(GraphBatch &batch, unsigned numThreads = 1);
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef GRAPH_BUILDER_HPP_
+#define GRAPH_BUILDER_HPP_
+
+#include "Graph.hpp"
+#include "GraphFingerprint.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace graph {
+    /**
+     * Two-pass graph construction. The edges are collected first, then
+     * the degree of every vertex is counted so that each adjacency list
+     * is allocated with its exact size before being filled. The built
+     * graph has no slack capacity and never reallocates while it's
+     * being filled.
+     */
+    class GraphBuilder {
+    public:
+        /**
+         * Constructor that receives the shape of the graph to be built.
+         * 
+         * @param std::size_t Number of vertices
+         * @param bool Is a directed graph?
+         * @param std::size_t Expected number of edges (optional)
+         * @param bool Keep only the lightest of the parallel edges
+         * between each pair of vertices? (optional)
+         */
+        GraphBuilder(std::size_t size, bool isDirected, std::size_t numEdges = 0,
+                     bool collapseParallelEdges = false);
+        
+        /**
+         * Collects an edge, using the same convention as
+         * Graph::appendEdge.
+         * 
+         * @param int Origin vertex
+         * @param Edge Pair formed by weight
+         * and destination vertex
+         */
+        void appendEdge(int vertex, Edge edge) {
+            this->edges.push_back(std::make_pair(edge, vertex));
+            this->edgeFingerprint.appendEdge(vertex, edge);
+        }
+        
+        /**
+         * Returns the canonical fingerprint of the collected edges
+         * (see GraphFingerprint), available before the graph is built.
+         * 
+         * @return Fingerprint Fingerprint
+         */
+        Fingerprint fingerprint() const {
+            return this->edgeFingerprint.value();
+        }
+        
+        /**
+         * Builds the graph with the collected edges. The collected
+         * edges are released, so the builder can be reused, but the
+         * fingerprint keeps describing the built graph.
+         * 
+         * @return Graph The built graph
+         */
+        Graph build();
+        
+    private:
+        std::size_t size;
+        bool isDirected;
+        bool collapseParallelEdges;
+        
+        // Collected edges: the edge itself and its origin vertex.
+        EdgeList edges;
+        
+        // Fingerprint of the collected edges.
+        GraphFingerprint edgeFingerprint;
+    };
+    
+    /**
+     * Removes the parallel edges of a range, keeping only the lightest
+     * edge between each pair of vertices (unordered pairs for
+     * undirected graphs), with a sort-dedup pass. The range is
+     * reordered in place, and undirected edges may be flipped.
+     * 
+     * @param EdgeList::iterator Begin of the range
+     * @param EdgeList::iterator End of the range
+     * @param bool Are the edges directed?
+     * @return EdgeList::iterator New end of the range
+     */
+    EdgeList::iterator removeParallelEdges(EdgeList::iterator begin,
+                                           EdgeList::iterator end, bool isDirected);
+}
+
+#endif
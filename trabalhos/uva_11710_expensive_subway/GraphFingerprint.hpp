@@ -0,0 +1,83 @@
+#ifndef GRAPH_FINGERPRINT_HPP_
+#define GRAPH_FINGERPRINT_HPP_
+
+#include "Graph.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+    /**
+     * Fingerprint of a graph. The hash picks the cache slot; the
+     * independent check hash and the counts verify a hit, so that a
+     * collision of the hash alone is treated as a different graph.
+     */
+    struct Fingerprint {
+        std::uint64_t hash;
+        std::uint64_t check;
+        std::uint64_t numVertices;
+        std::uint64_t numEdges;
+        
+        bool operator ==(const Fingerprint &other) const {
+            return this->hash == other.hash && this->check == other.check &&
+                   this->numVertices == other.numVertices && this->numEdges == other.numEdges;
+        }
+    };
+    
+    /**
+     * Hash functor of Fingerprint, for unordered containers.
+     */
+    struct FingerprintHash {
+        std::size_t operator ()(const Fingerprint &fingerprint) const {
+            return static_cast<std::size_t>(fingerprint.hash);
+        }
+    };
+    
+    /**
+     * Canonical fingerprint of a graph: hashes of its edge multiset
+     * that don't depend on the order in which the edges are appended
+     * (nor on the direction of undirected edges). Each edge is hashed
+     * on its own and the hashes are added up, so that repeated edges
+     * still count. It's computed incrementally, while the graph is
+     * being read.
+     */
+    class GraphFingerprint {
+    public:
+        /** 
+         * Constructor that receives the shape of the graph.
+         * 
+         * @param std::size_t Number of vertices
+         * @param bool Is a directed graph?
+         */
+        GraphFingerprint(std::size_t size, bool isDirected)
+                : size(size), isDirected(isDirected), numEdges(0), sum(0), checkSum(0) {}
+        
+        /**
+         * Adds an edge to the fingerprint, using the same convention
+         * as Graph::appendEdge.
+         * 
+         * @param int Origin vertex
+         * @param Edge Pair formed by weight 
+         * and destination vertex
+         */
+        void appendEdge(int vertex, Edge edge);
+        
+        /**
+         * Returns the fingerprint of the edges added so far.
+         * 
+         * @return Fingerprint Fingerprint
+         */
+        Fingerprint value() const;
+        
+    private:
+        std::size_t size;
+        bool isDirected;
+        std::uint64_t numEdges;
+        
+        // Sums of two independent hashes of the edges.
+        std::uint64_t sum;
+        std::uint64_t checkSum;
+    };
+}
+
+#endif
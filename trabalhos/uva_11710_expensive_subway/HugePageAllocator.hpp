@@ -0,0 +1,137 @@
+#ifndef HUGE_PAGE_ALLOCATOR_HPP_
+#define HUGE_PAGE_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace graph {
+    // Size of a huge page, and the minimum size of an allocation
+    // that is backed by huge pages.
+    const std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    
+    /**
+     * Allocates memory backed by huge pages, which cuts TLB misses
+     * on large arrays. Reserved huge pages (MAP_HUGETLB) are tried
+     * first; if there are none, a huge page aligned mapping is asked
+     * to use transparent huge pages (MADV_HUGEPAGE), which the kernel
+     * may ignore. Systems without mmap get regular memory.
+     * 
+     * @param std::size_t Number of bytes, multiple of HUGE_PAGE_SIZE
+     * @return void* Allocated memory
+     */
+    inline void *allocateHugePages(std::size_t bytes) {
+#ifdef __linux__
+        void *memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED) {
+            return memory;
+        }
+        
+        // Map one extra huge page, so that the mapping can be trimmed
+        // to start at a huge page boundary.
+        char *mapped = static_cast<char *>(mmap(NULL, bytes + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (mapped == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mapped);
+        std::size_t head = (HUGE_PAGE_SIZE - address % HUGE_PAGE_SIZE) % HUGE_PAGE_SIZE;
+        char *aligned = mapped + head;
+        
+        if (head > 0) {
+            munmap(mapped, head);
+        }
+        munmap(aligned + bytes, HUGE_PAGE_SIZE - head);
+        
+        madvise(aligned, bytes, MADV_HUGEPAGE);
+        return aligned;
+#else
+        return ::operator new(bytes);
+#endif
+    }
+    
+    /**
+     * Releases memory returned by allocateHugePages.
+     * 
+     * @param void* Allocated memory
+     * @param std::size_t Number of bytes, as passed to allocateHugePages
+     */
+    inline void freeHugePages(void *memory, std::size_t bytes) {
+#ifdef __linux__
+        munmap(memory, bytes);
+#else
+        (void) bytes;
+        ::operator delete(memory);
+#endif
+    }
+    
+    /**
+     * Allocator that backs large arrays (at least HUGE_PAGE_SIZE bytes)
+     * with huge pages, and smaller ones with regular memory.
+     */
+    template <typename T>
+    class HugePageAllocator {
+    public:
+        typedef T value_type;
+        
+        HugePageAllocator() {}
+        
+        template <typename U>
+        HugePageAllocator(const HugePageAllocator<U> &) {}
+        
+        T *allocate(std::size_t n) {
+            const std::size_t bytes = n * sizeof(T);
+            
+            if (bytes < HUGE_PAGE_SIZE) {
+                return static_cast<T *>(::operator new(bytes));
+            }
+            
+            return static_cast<T *>(allocateHugePages(roundUp(bytes)));
+        }
+        
+        void deallocate(T *memory, std::size_t n) {
+            const std::size_t bytes = n * sizeof(T);
+            
+            if (bytes < HUGE_PAGE_SIZE) {
+                ::operator delete(memory);
+            } else {
+                freeHugePages(memory, roundUp(bytes));
+            }
+        }
+        
+    private:
+        static std::size_t roundUp(std::size_t bytes) {
+            return (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        }
+    };
+    
+    template <typename T, typename U>
+    bool operator ==(const HugePageAllocator<T> &, const HugePageAllocator<U> &) {
+        return true;
+    }
+    
+    template <typename T, typename U>
+    bool operator !=(const HugePageAllocator<T> &, const HugePageAllocator<U> &) {
+        return false;
+    }
+    
+    // Vector for the large flat arrays of the graph algorithms (edge
+    // lists, compressed adjacency arrays, visited bitmaps). Compiling
+    // with -DGRAPH_HUGE_PAGES backs them with huge pages.
+#ifdef GRAPH_HUGE_PAGES
+    template <typename T>
+    using LargeVector = std::vector<T, HugePageAllocator<T>>;
+#else
+    template <typename T>
+    using LargeVector = std::vector<T>;
+#endif
+}
+
+#endif
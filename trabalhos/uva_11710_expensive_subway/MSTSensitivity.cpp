@@ -0,0 +1,229 @@
+#include "DisjointSet.hpp"
+#include "MSTSensitivity.hpp"
+
+#include <algorithm>
+
+namespace graph {
+    /**
+     * Finds the nearest ancestor of x (x itself included) whose parent
+     * edge isn't covered yet, compressing the path along the way.
+     */
+    static int uncovered(std::vector<int> &jump, int x) {
+        int root = x;
+        while (jump[root] != root) {
+            root = jump[root];
+        }
+        
+        while (jump[x] != root) {
+            int next = jump[x];
+            jump[x] = root;
+            x = next;
+        }
+        
+        return root;
+    }
+    
+    /**
+     * Returns whichever of the two tree edge indexes has the heavier
+     * edge, where -1 stands for no edge at all.
+     */
+    static int heavier(const std::vector<std::pair<Edge, int>> &treeEdges, int a, int b) {
+        if (a == -1) {
+            return b;
+        }
+        
+        if (b == -1) {
+            return a;
+        }
+        
+        return treeEdges[b].first.first > treeEdges[a].first.first ? b : a;
+    }
+    
+    MSTSensitivity mstSensitivity(const Graph &graph) {
+        const std::size_t graphSize = graph.size();
+        MSTSensitivity result;
+        result.mstWeight = 0;
+        result.hasSecondBest = false;
+        result.secondBestWeight = 0;
+        result.secondBestRemoved = -1;
+        
+        // Each undirected edge once, self-loops dropped.
+        EdgeList edges;
+        for (std::size_t i = 0; i < graphSize; i++) {
+            const AdjacentEdges &adj = graph[i];
+            const std::size_t numEdges = adj.size();
+            
+            for (std::size_t j = 0; j < numEdges; j++) {
+                if (static_cast<std::size_t>(adj[j].second) > i) {
+                    edges.push_back(std::make_pair(adj[j], i));
+                }
+            }
+        }
+        
+        std::sort(edges.begin(), edges.end());
+        const std::size_t totalEdges = edges.size();
+        
+        // Kruskal, keeping the non-tree edges (already sorted).
+        EdgeList otherEdges;
+        std::vector<AdjacentEdges> tree(graphSize);
+        disjointSet::DisjointSet disjointSet(graphSize);
+        
+        for (std::size_t i = 0; i < totalEdges; i++) {
+            const std::pair<Edge, int> &edge = edges[i];
+            int srcRoot = disjointSet.find(edge.second);
+            int destRoot = disjointSet.find(edge.first.second);
+            
+            if (srcRoot != destRoot) {
+                // The tree adjacency lists store the tree edge index
+                // in place of the weight.
+                int index = result.treeEdges.size();
+                tree[edge.second].push_back(std::make_pair(index, edge.first.second));
+                tree[edge.first.second].push_back(std::make_pair(index, edge.second));
+                
+                result.treeEdges.push_back(edge);
+                result.mstWeight += edge.first.first;
+                disjointSet.merge(srcRoot, destRoot);
+            } else {
+                otherEdges.push_back(edge);
+            }
+        }
+        
+        EdgeList().swap(edges);
+        const std::vector<std::pair<Edge, int>> &treeEdges = result.treeEdges;
+        
+        // Root every tree of the forest, recording the parent, the depth
+        // and the index of the edge to the parent of each vertex.
+        std::vector<int> parent(graphSize, -1);
+        std::vector<int> parentEdge(graphSize, -1);
+        std::vector<int> depth(graphSize, 0);
+        std::vector<bool> visited(graphSize, false);
+        std::vector<int> queue;
+        queue.reserve(graphSize);
+        
+        for (std::size_t root = 0; root < graphSize; root++) {
+            if (visited[root]) {
+                continue;
+            }
+            
+            std::size_t head = queue.size();
+            visited[root] = true;
+            parent[root] = root;
+            queue.push_back(root);
+            
+            while (head < queue.size()) {
+                int v = queue[head++];
+                const std::size_t numAdj = tree[v].size();
+                
+                for (std::size_t j = 0; j < numAdj; j++) {
+                    int u = tree[v][j].second;
+                    
+                    if (!visited[u]) {
+                        visited[u] = true;
+                        parent[u] = v;
+                        parentEdge[u] = tree[v][j].first;
+                        depth[u] = depth[v] + 1;
+                        queue.push_back(u);
+                    }
+                }
+            }
+        }
+        
+        std::vector<AdjacentEdges>().swap(tree);
+        
+        // Binary lifting: up[k][v] is the 2^k-th ancestor of v and
+        // heaviest[k][v] the index of the heaviest tree edge on the way
+        // (-1 if there's none).
+        std::size_t levels = 1;
+        while ((static_cast<std::size_t>(1) << levels) < graphSize) {
+            levels++;
+        }
+        
+        std::vector<std::vector<int>> up(levels, std::vector<int>(graphSize));
+        std::vector<std::vector<int>> heaviest(levels, std::vector<int>(graphSize));
+        for (std::size_t v = 0; v < graphSize; v++) {
+            up[0][v] = parent[v];
+            heaviest[0][v] = parentEdge[v];
+        }
+        
+        for (std::size_t k = 1; k < levels; k++) {
+            for (std::size_t v = 0; v < graphSize; v++) {
+                int middle = up[k - 1][v];
+                
+                up[k][v] = up[k - 1][middle];
+                heaviest[k][v] = heavier(treeEdges, heaviest[k - 1][v], heaviest[k - 1][middle]);
+            }
+        }
+        
+        std::vector<long long> replacement(treeEdges.size(), -1);
+        std::vector<int> jump(graphSize);
+        for (std::size_t v = 0; v < graphSize; v++) {
+            jump[v] = v;
+        }
+        
+        const std::size_t numOther = otherEdges.size();
+        for (std::size_t i = 0; i < numOther; i++) {
+            const std::pair<Edge, int> &edge = otherEdges[i];
+            const int weight = edge.first.first;
+            int u = edge.second;
+            int v = edge.first.second;
+            
+            // Lowest common ancestor, tracking the heaviest tree edge
+            // on the path between u and v.
+            int heaviestEdge = -1;
+            int x = u, y = v;
+            if (depth[x] < depth[y]) {
+                std::swap(x, y);
+            }
+            
+            for (std::size_t k = levels; k-- > 0;) {
+                if (depth[x] - (1 << k) >= depth[y]) {
+                    heaviestEdge = heavier(treeEdges, heaviestEdge, heaviest[k][x]);
+                    x = up[k][x];
+                }
+            }
+            
+            for (std::size_t k = levels; k-- > 0 && x != y;) {
+                if (up[k][x] != up[k][y]) {
+                    heaviestEdge = heavier(treeEdges, heaviestEdge, heaviest[k][x]);
+                    heaviestEdge = heavier(treeEdges, heaviestEdge, heaviest[k][y]);
+                    x = up[k][x];
+                    y = up[k][y];
+                }
+            }
+            
+            if (x != y) {
+                heaviestEdge = heavier(treeEdges, heaviestEdge, parentEdge[x]);
+                heaviestEdge = heavier(treeEdges, heaviestEdge, parentEdge[y]);
+                x = parent[x];
+            }
+            
+            const int lca = x;
+            
+            // Best swap for the second-best spanning tree.
+            long long swapped = result.mstWeight + weight - treeEdges[heaviestEdge].first.first;
+            if (!result.hasSecondBest || swapped < result.secondBestWeight) {
+                result.hasSecondBest = true;
+                result.secondBestWeight = swapped;
+                result.secondBestRemoved = heaviestEdge;
+                result.secondBestAdded = edge;
+            }
+            
+            // Since the non-tree edges come in increasing weight order,
+            // this is the lightest replacement of every tree edge on the
+            // cycle that isn't covered yet.
+            const int ends[2] = {u, v};
+            for (int e = 0; e < 2; e++) {
+                int w = uncovered(jump, ends[e]);
+                
+                while (depth[w] > depth[lca]) {
+                    replacement[parentEdge[w]] = weight - treeEdges[parentEdge[w]].first.first;
+                    jump[w] = parent[w];
+                    w = uncovered(jump, w);
+                }
+            }
+        }
+        
+        result.replacementCost.swap(replacement);
+        return result;
+    }
+}
@@ -0,0 +1,141 @@
+#include "GraphBuilder.hpp"
+#include "MSTServer.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <sstream>
+
+namespace graph {
+    MSTServer::MSTServer(long long maxSize)
+            : maxSize(std::min<long long>(maxSize, std::numeric_limits<int>::max())) {}
+    
+    void MSTServer::serve(std::istream &input, std::ostream &output) {
+        std::string line;
+        bool quit = false;
+        
+        while (!quit && std::getline(input, line)) {
+            if (line.empty()) {
+                continue;
+            }
+            
+            output << this->handle(line, input, quit) << '\n';
+            output.flush();
+        }
+    }
+    
+    std::string MSTServer::handle(const std::string &line, std::istream &input, bool &quit) {
+        std::istringstream command(line);
+        std::string name, id;
+        command >> name;
+        
+        if (name == "QUIT") {
+            quit = true;
+            return "OK";
+        }
+        
+        if (!(command >> id)) {
+            return "ERROR missing graph id";
+        }
+        
+        if (name == "LOAD") {
+            long long numVertices, numEdges;
+            
+            if (!(command >> numVertices >> numEdges) || numVertices < 0 || numEdges < 0) {
+                return "ERROR usage: LOAD <id> <vertices> <edges>";
+            }
+            
+            // A graph that doesn't fit in memory fails only this
+            // command; the graphs already loaded are kept.
+            try {
+                return this->load(id, numVertices, numEdges, input);
+            } catch (const std::bad_alloc &) {
+                return "ERROR out of memory loading graph " + id;
+            }
+        }
+        
+        if (name == "DROP") {
+            return this->graphs.erase(id) > 0 ? "OK" : "ERROR unknown graph " + id;
+        }
+        
+        if (name != "CONNECTED" && name != "WEIGHT" && name != "BOTTLENECK") {
+            return "ERROR unknown command " + name;
+        }
+        
+        std::unordered_map<std::string, CachedGraph>::const_iterator it = this->graphs.find(id);
+        if (it == this->graphs.end()) {
+            return "ERROR unknown graph " + id;
+        }
+        
+        const SpanningForest &forest = it->second.forest;
+        if (name == "CONNECTED") {
+            return forest.isConnected ? "YES" : "NO";
+        }
+        
+        if (!forest.isConnected) {
+            return "IMPOSSIBLE";
+        }
+        
+        // An empty graph has no component at all.
+        if (forest.weights.empty()) {
+            return "0";
+        }
+        
+        std::ostringstream value;
+        if (name == "WEIGHT") {
+            value << forest.weights[0];
+        } else {
+            value << forest.bottlenecks[0];
+        }
+        
+        return value.str();
+    }
+    
+    std::string MSTServer::load(const std::string &id, long long numVertices,
+                                long long numEdges, std::istream &input) {
+        const bool tooLarge = numVertices > this->maxSize || numEdges > this->maxSize;
+        GraphBuilder builder(tooLarge ? 0 : numVertices, false, tooLarge ? 0 : numEdges);
+        bool valid = true;
+        
+        // Each edge is read from a line of its own. The edge lines are
+        // consumed even if the graph is too large or an edge is out of
+        // range, so that the next command is read correctly; a short
+        // or malformed line ends the edges there, as the lines after
+        // it are likely the next commands.
+        std::string line;
+        for (long long i = 0; i < numEdges; i++) {
+            if (!std::getline(input, line)) {
+                valid = false;
+                break;
+            }
+            
+            std::istringstream edge(line);
+            int from, to, weight;
+            
+            if (!(edge >> from >> to >> weight) || !(edge >> std::ws).eof()) {
+                valid = false;
+                break;
+            }
+            
+            if (from < 0 || from >= numVertices || to < 0 || to >= numVertices) {
+                valid = false;
+            } else if (valid && !tooLarge) {
+                builder.appendEdge(from, std::make_pair(weight, to));
+            }
+        }
+        
+        if (tooLarge) {
+            std::ostringstream error;
+            error << "ERROR graph " << id << " exceeds " << this->maxSize << " vertices or edges";
+            return error.str();
+        }
+        
+        if (!valid) {
+            return "ERROR invalid edge in graph " + id;
+        }
+        
+        this->graphs.erase(id);
+        this->graphs.insert(std::make_pair(id, CachedGraph(builder.build())));
+        return "OK";
+    }
+}
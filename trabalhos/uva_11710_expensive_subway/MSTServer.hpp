@@ -0,0 +1,94 @@
+#ifndef MST_SERVER_HPP_
+#define MST_SERVER_HPP_
+
+#include "Graph.hpp"
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace graph {
+    /**
+     * A graph loaded by the server, frozen together with its
+     * minimum spanning forest, which is computed only once.
+     */
+    struct CachedGraph {
+        Graph graph;
+        SpanningForest forest;
+        
+        explicit CachedGraph(Graph graph)
+                : graph(std::move(graph)), forest(this->graph.minimumSpanningForest()) {}
+    };
+    
+    /**
+     * Resident server that keeps graphs loaded between requests, so
+     * that process startup and parsing are paid once per graph
+     * instead of once per query. It speaks a line protocol, one
+     * command per line and one response line per command:
+     * 
+     * LOAD <id> <vertices> <edges>  followed by one "from to weight"
+     *                               line per edge; replaces any graph
+     *                               with the same id
+     * CONNECTED <id>                YES or NO
+     * WEIGHT <id>                   MST weight, or IMPOSSIBLE
+     * BOTTLENECK <id>               heaviest MST edge, or IMPOSSIBLE
+     * DROP <id>                     forgets the graph
+     * QUIT                          stops the server
+     * 
+     * Successful commands without a value answer OK, and invalid
+     * ones answer ERROR followed by a description; so do graphs
+     * larger than the configured limit or than the memory available.
+     * A short or malformed edge line fails the LOAD and ends its
+     * edges, the following lines being read as commands.
+     */
+    class MSTServer {
+    public:
+        // Default limit of vertices and of edges of a loaded graph.
+        static const long long DEFAULT_MAX_SIZE = 1 << 24;
+        
+        /**
+         * Constructor that sets the limit of vertices and of edges of
+         * a loaded graph, which is never above the range of int
+         * vertex ids.
+         * 
+         * @param long long Maximum number of vertices and of edges
+         */
+        explicit MSTServer(long long maxSize = DEFAULT_MAX_SIZE);
+        
+        /**
+         * Answers commands read from the input until QUIT or the
+         * end of the input. Every response is flushed right away.
+         * 
+         * @param std::istream& Stream the commands are read from
+         * @param std::ostream& Stream the responses are written to
+         */
+        void serve(std::istream &input, std::ostream &output);
+        
+    private:
+        long long maxSize;
+        
+        // Loaded graphs by id.
+        std::unordered_map<std::string, CachedGraph> graphs;
+        
+        /**
+         * Runs a single command.
+         * 
+         * @param const std::string& Command line
+         * @param std::istream& Input, from which LOAD reads its edges
+         * @param bool& Set to true when the server must stop
+         * @return std::string Response
+         */
+        std::string handle(const std::string &line, std::istream &input, bool &quit);
+        
+        /**
+         * Reads the edges of a LOAD command and caches the graph.
+         * 
+         * @return std::string Response
+         */
+        std::string load(const std::string &id, long long numVertices,
+                         long long numEdges, std::istream &input);
+    };
+}
+
+#endif
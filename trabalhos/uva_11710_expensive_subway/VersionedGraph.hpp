@@ -0,0 +1,147 @@
+#ifndef VERSIONED_GRAPH_HPP_
+#define VERSIONED_GRAPH_HPP_
+
+#include "Graph.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace graph {
+    // Adjacency lists of a fixed range of vertices, the unit of
+    // sharing between graph versions.
+    typedef std::vector<AdjacentEdges> AdjacencyBlock;
+    
+    // Number of vertices per adjacency block.
+    const std::size_t ADJACENCY_BLOCK_SIZE = 64;
+    
+    /**
+     * Immutable version of a VersionedGraph. Its blocks are never
+     * modified after being published, so any number of threads can
+     * read a snapshot they hold without locking.
+     */
+    class GraphSnapshot {
+    public:
+        /**
+         * Returns the number of vertices in the graph.
+         * 
+         * @return std::size_t Number of vertices
+         */
+        std::size_t size() const {
+            return this->numVertices;
+        }
+        
+        /**
+         * Returns the version number of this snapshot, which grows
+         * by one on each publication.
+         * 
+         * @return unsigned long Version number
+         */
+        unsigned long version() const {
+            return this->number;
+        }
+        
+        /**
+         * Overloaded bracket operator that allows one to read 
+         * this graph in the form of <variable_name[vertex_index]>
+         * 
+         * @param std::size_t index
+         * @return const AdjacentEdges& Reference to the list of adjacent edges
+         */
+        const AdjacentEdges &operator [](std::size_t i) const {
+            return (*this->blocks[i / ADJACENCY_BLOCK_SIZE])[i % ADJACENCY_BLOCK_SIZE];
+        }
+        
+        /**
+         * Determines whether the graph is connected or not,
+         * using breadth-first search to visit vertices.
+         */
+        bool isConnected() const;
+        
+        /**
+         * Builds a minimum spanning tree (or forest, if the graph
+         * isn't connected) using Kruskal's algorithm.
+         * 
+         * @return Graph that represents the minimum spanning tree
+         */
+        Graph kruskalMST() const;
+        
+    private:
+        friend class VersionedGraph;
+        
+        std::size_t numVertices;
+        bool isDirected;
+        unsigned long number;
+        std::vector<std::shared_ptr<const AdjacencyBlock>> blocks;
+    };
+    
+    /**
+     * Graph with copy-on-write versioning, for a single writer thread
+     * appending edges while many reader threads query consistent
+     * snapshots.
+     * 
+     * The adjacency lists are split in blocks of ADJACENCY_BLOCK_SIZE
+     * vertices. The first change to a block after a publication copies
+     * that block only, and publishing a version shares every block with
+     * the previous one, except those that changed.
+     */
+    class VersionedGraph {
+    public:
+        /** 
+         * Constructor that initializes the graph with an specific
+         * size and publishes its first (empty) version.
+         * 
+         * @param std::size_t Number of vertices
+         * @param bool Is a directed graph?
+         */
+        VersionedGraph(std::size_t size, bool isDirected);
+        
+        /**
+         * Append an edge to the working version of the graph, in both
+         * directions for undirected graphs. Readers only see it after
+         * the next publish(). Must only be called by the writer thread.
+         * 
+         * @param int Origin vertex
+         * @param Edge Pair formed by weight 
+         * and destination vertex
+         */
+        void appendEdge(int vertex, Edge edge);
+        
+        /**
+         * Publishes the working version as a new snapshot. Must only
+         * be called by the writer thread.
+         * 
+         * @return std::shared_ptr<const GraphSnapshot> Published snapshot
+         */
+        std::shared_ptr<const GraphSnapshot> publish();
+        
+        /**
+         * Returns the latest published snapshot. Safe to be called by
+         * any thread, concurrently with the writer.
+         * 
+         * @return std::shared_ptr<const GraphSnapshot> Latest snapshot
+         */
+        std::shared_ptr<const GraphSnapshot> snapshot() const;
+        
+    private:
+        std::size_t numVertices;
+        bool isDirected;
+        unsigned long nextVersion;
+        
+        // Blocks of the working version, and whether each of them was
+        // already copied since the last publication.
+        std::vector<std::shared_ptr<AdjacencyBlock>> blocks;
+        std::vector<bool> copied;
+        
+        // Latest published snapshot, only accessed atomically.
+        std::shared_ptr<const GraphSnapshot> published;
+        
+        /**
+         * Returns the working copy of the block of a vertex, copying
+         * the block first if it's still shared with a snapshot.
+         */
+        AdjacentEdges &adjacentEdges(std::size_t vertex);
+    };
+}
+
+#endif
@@ -1,9 +1,12 @@
-#include "Graph.hpp"
+#include "EdgePipeline.hpp"
+#include "GraphBuilder.hpp"
+#include "LRUCache.hpp"
 
 #include <iostream>
 #include <map>
 #include <queue>
 #include <string>
+#include <utility>
 
 int main() {
 	freopen("input.in", "r", stdin);
@@ -12,9 +15,13 @@ int main() {
 	int numStations, numConnections;
 	std::cin >> numStations >> numConnections;
 	
+	// Results of the last networks solved, by fingerprint: whether
+	// the network is connected and the weight of its MST.
+	graph::LRUCache<std::pair<bool, long long>> cache(1024);
+	
 	while (numStations != 0 || numConnections != 0) {
 	    std::map<std::string, int> stations;
-    	graph::Graph graph(numStations, false);
+    	graph::GraphBuilder builder(numStations, false, numConnections, true);
     	
     	for (int i = 0; i < numStations; i++) {
     	    std::string station;
@@ -23,37 +30,33 @@ int main() {
     	    stations.insert(std::make_pair(station, i));
     	}
     	
-    	for (int i = 0; i < numConnections; i++) {
-    	    std::string from, to;
-    	    int weight;
-    	    
-    	    std::cin >> from >> to >> weight;
-    	    graph.appendEdge(stations[from], std::make_pair(weight, stations[to]));
+    	// Stations are numbered in name order, so the order in which
+    	// they are listed doesn't change the fingerprint.
+    	int id = 0;
+    	for (std::map<std::string, int>::iterator it = stations.begin(); it != stations.end(); ++it) {
+    	    it->second = id++;
     	}
     	
+    	// Parsing runs on its own thread while the builder is filled.
+    	graph::pipelinedLoad(std::cin, numConnections, graph::NamedEdgeParser(stations), builder);
+    	
     	std::string startStation;
     	std::cin >> startStation;
     	
-        if (graph.isConnected()) {
-    	   // graph::Graph mst = graph.primMST(stations[startStation]);
-    	    graph::Graph mst = graph.kruskalMST();
-    	   
-    	    int weightMst = 0;
-    	    const std::size_t sizeMST = mst.size();
-    	   
-    	    for (std::size_t i = 0; i < sizeMST; i++) {
-    	        const std::size_t numEdges = mst[i].size();
-    	       
-    	        for (std::size_t j = 0; j < numEdges; j++) {
-    	            weightMst += mst[i][j].first;
-    	        }
-            }
-    	   
-    	    // Since it's an undirected graph, the weight of each edge
-    	    // was counted twice.
-    	    weightMst /= 2;
-    	    std::cout << weightMst << std::endl;
+    	std::pair<bool, long long> result;
+    	if (!cache.get(builder.fingerprint(), result)) {
+    	    graph::Graph graph = builder.build();
     	    
+    	    // A single Kruskal pass builds the forest and tells whether
+    	    // the graph is connected.
+    	    graph::SpanningForest msf = graph.minimumSpanningForest();
+    	    
+    	    result = std::make_pair(msf.isConnected, msf.isConnected ? msf.weights[0] : 0LL);
+    	    cache.put(builder.fingerprint(), result);
+    	}
+    	
+        if (result.first) {
+    	    std::cout << result.second << std::endl;
     	} else {
     	    std::cout << "Impossible" << std::endl;
     	}
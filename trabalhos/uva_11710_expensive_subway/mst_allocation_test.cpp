@@ -0,0 +1,115 @@
+#include "Graph.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// Number of calls to operator new since the program started.
+static std::size_t numAllocations = 0;
+
+void *operator new(std::size_t size) {
+    numAllocations++;
+    
+    void *p = std::malloc(size > 0 ? size : 1);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    
+    return p;
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+static std::uint64_t nextRandom(std::uint64_t &state) {
+    // xorshift64
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    
+    return state;
+}
+
+/**
+ * Total weight of an undirected tree (each edge is stored twice).
+ */
+static long long treeWeight(const graph::Graph &tree) {
+    long long weight = 0;
+    
+    for (std::size_t i = 0; i < tree.size(); i++) {
+        for (std::size_t j = 0; j < tree[i].size(); j++) {
+            weight += tree[i][j].first;
+        }
+    }
+    
+    return weight / 2;
+}
+
+/**
+ * Checks that the workspace overloads of kruskalMST and primMST make no
+ * allocation at all once the output graph and the workspace are warm.
+ */
+int main() {
+    const std::size_t numVertices = 2000;
+    const std::size_t numEdges = 20000;
+    const int numQueries = 100;
+    
+    graph::Graph graph(numVertices, false);
+    std::uint64_t state = 88172645463325252ULL;
+    
+    for (std::size_t i = 0; i < numEdges; i++) {
+        int from = nextRandom(state) % numVertices;
+        int to = nextRandom(state) % numVertices;
+        int weight = nextRandom(state) % 1000;
+        
+        graph.appendEdge(from, std::make_pair(weight, to));
+    }
+    
+    const long long expected = treeWeight(graph.kruskalMST());
+    
+    // Warm up: the first calls size the buffers.
+    graph::Graph mst(0, false);
+    graph::MSTWorkspace workspace;
+    graph.kruskalMST(mst, workspace);
+    graph.primMST(0, mst, workspace);
+    
+    bool ok = true;
+    
+    std::size_t before = numAllocations;
+    for (int i = 0; i < numQueries; i++) {
+        graph.kruskalMST(mst, workspace);
+    }
+    std::size_t kruskalAllocations = numAllocations - before;
+    ok = ok && kruskalAllocations == 0 && treeWeight(mst) == expected;
+    
+    before = numAllocations;
+    for (int i = 0; i < numQueries; i++) {
+        graph.primMST(0, mst, workspace);
+    }
+    std::size_t primAllocations = numAllocations - before;
+    ok = ok && primAllocations == 0 && treeWeight(mst) == expected;
+    
+    std::printf("kruskalMST: %zu allocations in %d queries\n", kruskalAllocations, numQueries);
+    std::printf("primMST: %zu allocations in %d queries\n", primAllocations, numQueries);
+    std::printf("%s\n", ok ? "OK" : "FAILED");
+    
+    return ok ? 0 : 1;
+}
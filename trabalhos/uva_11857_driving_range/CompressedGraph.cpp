@@ -0,0 +1,178 @@
+#include "CompressedGraph.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace graph {
+    CompressedGraph::CompressedGraph(const Graph &graph)
+            : weightBits(0), minWeight(0) {
+        const std::size_t graphSize = graph.size();
+        
+        this->edgeOffsets.reserve(graphSize + 1);
+        this->destinationOffsets.reserve(graphSize + 1);
+        this->edgeOffsets.push_back(0);
+        
+        // 1st pass: weight range, which defines the packing width.
+        std::int64_t maxWeight = std::numeric_limits<int>::min();
+        this->minWeight = std::numeric_limits<int>::max();
+        for (std::size_t i = 0; i < graphSize; i++) {
+            const AdjacentEdges &adj = graph[i];
+            const std::size_t numEdges = adj.size();
+            
+            for (std::size_t j = 0; j < numEdges; j++) {
+                this->minWeight = std::min<std::int64_t>(this->minWeight, adj[j].first);
+                maxWeight = std::max<std::int64_t>(maxWeight, adj[j].first);
+            }
+            
+            this->edgeOffsets.push_back(this->edgeOffsets.back() + numEdges);
+        }
+        
+        const std::uint64_t totalEdges = this->edgeOffsets.back();
+        if (totalEdges == 0) {
+            this->minWeight = 0;
+        } else {
+            std::uint64_t range = static_cast<std::uint64_t>(maxWeight - this->minWeight);
+            while (range >> this->weightBits) {
+                this->weightBits++;
+            }
+        }
+        
+        this->weights.assign((totalEdges * this->weightBits + 63) / 64, 0);
+        
+        // 2nd pass: sort each adjacency list by destination and encode it.
+        std::vector<std::pair<int, int>> sorted;
+        std::uint64_t edgeIndex = 0;
+        for (std::size_t i = 0; i < graphSize; i++) {
+            const AdjacentEdges &adj = graph[i];
+            sorted.clear();
+            
+            const std::size_t numEdges = adj.size();
+            for (std::size_t j = 0; j < numEdges; j++) {
+                sorted.push_back(std::make_pair(adj[j].second, adj[j].first));
+            }
+            
+            std::sort(sorted.begin(), sorted.end());
+            this->destinationOffsets.push_back(this->destinations.size());
+            
+            std::int64_t previous = i;
+            for (std::size_t j = 0; j < numEdges; j++, edgeIndex++) {
+                std::int64_t delta = sorted[j].first - previous;
+                previous = sorted[j].first;
+                
+                // Zigzag encoding: small negative deltas stay small.
+                std::uint64_t value = (static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63);
+                while (value >= 0x80) {
+                    this->destinations.push_back(static_cast<std::uint8_t>(value | 0x80));
+                    value >>= 7;
+                }
+                this->destinations.push_back(static_cast<std::uint8_t>(value));
+                
+                if (this->weightBits > 0) {
+                    std::uint64_t packed = static_cast<std::uint64_t>(sorted[j].second - this->minWeight);
+                    const std::uint64_t bit = edgeIndex * this->weightBits;
+                    const std::size_t word = bit >> 6;
+                    const unsigned offset = bit & 63;
+                    
+                    this->weights[word] |= packed << offset;
+                    if (offset + this->weightBits > 64) {
+                        this->weights[word + 1] |= packed >> (64 - offset);
+                    }
+                }
+            }
+        }
+        
+        this->destinationOffsets.push_back(this->destinations.size());
+        this->destinations.shrink_to_fit();
+    }
+    
+    CompressedGraph::Cursor CompressedGraph::adjacentEdges(std::size_t vertex) const {
+        Cursor cursor;
+        cursor.graph = this;
+        cursor.position = this->destinations.data() + this->destinationOffsets[vertex];
+        cursor.previous = vertex;
+        cursor.weightIndex = this->edgeOffsets[vertex];
+        cursor.remaining = this->degree(vertex);
+        
+        return cursor;
+    }
+    
+    bool CompressedGraph::isConnected() const {
+        const std::size_t graphSize = this->size();
+        if (graphSize == 0) {
+            return true;
+        }
+        
+        LargeVector<bool> visited(graphSize, false);
+        LargeVector<int> stack(1, 0);
+        std::size_t numVisited = 0;
+        
+        while (!stack.empty()) {
+            int v = stack.back();
+            stack.pop_back();
+            
+            if (!visited[v]) {
+                visited[v] = true;
+                numVisited++;
+                
+                Cursor cursor = this->adjacentEdges(v);
+                Edge edge;
+                while (cursor.next(edge)) {
+                    if (!visited[edge.second]) {
+                        stack.push_back(edge.second);
+                    }
+                }
+            }
+        }
+        
+        return numVisited == graphSize;
+    }
+    
+    Graph CompressedGraph::primMST(int start) const {
+        const std::size_t graphSize = this->size();
+        Graph mst(graphSize, false);
+        LargeVector<bool> inMST(graphSize, false);
+        std::size_t sizeMST = 0;
+        
+        EdgeList minHeap;
+        std::greater<std::pair<Edge, int>> compare;
+        
+        Cursor cursor = this->adjacentEdges(start);
+        Edge edge;
+        while (cursor.next(edge)) {
+            minHeap.push_back(std::make_pair(edge, start));
+            std::push_heap(minHeap.begin(), minHeap.end(), compare);
+        }
+        
+        // Same steps as Graph::primMST.
+        while (!minHeap.empty() && sizeMST < graphSize) {
+            std::pop_heap(minHeap.begin(), minHeap.end(), compare);
+            Edge next = minHeap.back().first;
+            int from = minHeap.back().second;
+            int to = next.second;
+            minHeap.pop_back();
+            
+            if (!inMST[from] || !inMST[to]) {
+                mst.appendEdge(from, next);
+                inMST[from] = true;
+                inMST[to] = true;
+                sizeMST++;
+                
+                cursor = this->adjacentEdges(to);
+                while (cursor.next(edge)) {
+                    minHeap.push_back(std::make_pair(edge, to));
+                    std::push_heap(minHeap.begin(), minHeap.end(), compare);
+                }
+            }
+        }
+        
+        return mst;
+    }
+    
+    std::size_t CompressedGraph::memoryUsage() const {
+        return this->destinations.capacity() * sizeof(std::uint8_t)
+             + this->destinationOffsets.capacity() * sizeof(std::uint64_t)
+             + this->edgeOffsets.capacity() * sizeof(std::uint64_t)
+             + this->weights.capacity() * sizeof(std::uint64_t);
+    }
+}
@@ -0,0 +1,165 @@
+#ifndef COMPRESSED_GRAPH_HPP_
+#define COMPRESSED_GRAPH_HPP_
+
+#include "Graph.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graph {
+    /**
+     * Read-only compressed representation of a graph. The adjacency
+     * list of each vertex is sorted by destination vertex and stored as
+     * variable-length (varint) deltas: the first destination relative
+     * to the vertex itself and each following one relative to the
+     * previous destination. Weights are stored apart, bit-packed with
+     * the smallest width able to hold (weight - minimum weight).
+     */
+    class CompressedGraph {
+    public:
+        /**
+         * Sequential decoder of the adjacency list of a vertex.
+         */
+        class Cursor {
+        public:
+            /**
+             * Decodes the next adjacent edge.
+             * 
+             * @param Edge& Filled with the next edge (weight and
+             * destination vertex)
+             * @return bool False if there are no more edges
+             */
+            bool next(Edge &edge) {
+                if (this->remaining == 0) {
+                    return false;
+                }
+                
+                std::uint64_t value = 0;
+                unsigned shift = 0;
+                std::uint8_t byte;
+                do {
+                    byte = *this->position++;
+                    value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                    shift += 7;
+                } while (byte & 0x80);
+                
+                // Zigzag decoding: the first delta may be negative.
+                this->previous += static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+                
+                edge.first = this->graph->weight(this->weightIndex++);
+                edge.second = static_cast<int>(this->previous);
+                this->remaining--;
+                return true;
+            }
+            
+        private:
+            friend class CompressedGraph;
+            
+            const CompressedGraph *graph;
+            const std::uint8_t *position;
+            std::int64_t previous;
+            std::uint64_t weightIndex;
+            std::size_t remaining;
+        };
+        
+        /**
+         * Constructor that compresses an already built graph.
+         * 
+         * @param const Graph& Graph to be compressed
+         */
+        explicit CompressedGraph(const Graph &graph);
+        
+        /**
+         * Returns the number of vertices in the graph.
+         * 
+         * @return std::size_t Number of vertices
+         */
+        std::size_t size() const {
+            return this->edgeOffsets.size() - 1;
+        }
+        
+        /**
+         * Returns the number of edges adjacent to a vertex.
+         * 
+         * @param std::size_t Vertex
+         * @return std::size_t Number of adjacent edges
+         */
+        std::size_t degree(std::size_t vertex) const {
+            return this->edgeOffsets[vertex + 1] - this->edgeOffsets[vertex];
+        }
+        
+        /**
+         * Returns a cursor over the edges adjacent to a vertex, in
+         * increasing order of destination vertex.
+         * 
+         * @param std::size_t Vertex
+         * @return Cursor Decoder of the adjacency list
+         */
+        Cursor adjacentEdges(std::size_t vertex) const;
+        
+        /**
+         * Determines whether a graph is connected or not,
+         * using depth-first search to visit vertices.
+         */
+        bool isConnected() const;
+        
+        /**
+         * Builds a minimum spanning tree using Prim's algorithm and
+         * assuming that this graph is connected.
+         * 
+         * @param int Start vertex
+         * @return Graph that represents the minimum spanning tree
+         */
+        Graph primMST(int start) const;
+        
+        /**
+         * Returns the number of bytes used by the compressed
+         * representation.
+         * 
+         * @return std::size_t Memory usage in bytes
+         */
+        std::size_t memoryUsage() const;
+        
+    private:
+        // Varint-encoded destination deltas of every vertex, and the
+        // position where the list of each vertex starts.
+        LargeVector<std::uint8_t> destinations;
+        LargeVector<std::uint64_t> destinationOffsets;
+        
+        // Index of the first edge of each vertex (edgeOffsets[size()]
+        // is the total number of edges).
+        LargeVector<std::uint64_t> edgeOffsets;
+        
+        // Bit-packed weights, in edge order.
+        LargeVector<std::uint64_t> weights;
+        unsigned weightBits;
+        std::int64_t minWeight;
+        
+        /**
+         * Decodes the weight of an edge.
+         * 
+         * @param std::uint64_t Edge index
+         * @return int Weight
+         */
+        int weight(std::uint64_t index) const {
+            if (this->weightBits == 0) {
+                return static_cast<int>(this->minWeight);
+            }
+            
+            const std::uint64_t bit = index * this->weightBits;
+            const std::size_t word = bit >> 6;
+            const unsigned offset = bit & 63;
+            
+            std::uint64_t value = this->weights[word] >> offset;
+            if (offset + this->weightBits > 64) {
+                value |= this->weights[word + 1] << (64 - offset);
+            }
+            
+            value &= (~static_cast<std::uint64_t>(0)) >> (64 - this->weightBits);
+            return static_cast<int>(this->minWeight + static_cast<std::int64_t>(value));
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "ConcurrentDisjointSet.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace disjointSet {
+    /**
+     * Priority of an element (MurmurHash3 finalizer of its index).
+     */
+    static std::uint32_t priority(int x) {
+        std::uint32_t h = static_cast<std::uint32_t>(x);
+        h ^= h >> 16;
+        h *= 0x85EBCA6BU;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35U;
+        
+        return h ^ (h >> 16);
+    }
+    
+    ConcurrentDisjointSet::ConcurrentDisjointSet(std::size_t maxNumber)
+            : parents(maxNumber) {
+        for (std::size_t i = 0; i < maxNumber; i++) {
+            this->parents[i].store(i, std::memory_order_relaxed);
+        }
+    }
+    
+    bool ConcurrentDisjointSet::precedes(int x, int y) const {
+        std::uint32_t xPriority = priority(x);
+        std::uint32_t yPriority = priority(y);
+        
+        return xPriority < yPriority || (xPriority == yPriority && x < y);
+    }
+    
+    int ConcurrentDisjointSet::find(int x) {
+        while (true) {
+            int parent = this->parents[x].load(std::memory_order_acquire);
+            if (parent == x) {
+                return x;
+            }
+            
+            // Path splitting: point x to its grandparent, unless
+            // another thread changed it meanwhile.
+            int grandparent = this->parents[parent].load(std::memory_order_acquire);
+            if (grandparent != parent) {
+                int expected = parent;
+                this->parents[x].compare_exchange_weak(expected, grandparent,
+                        std::memory_order_release, std::memory_order_relaxed);
+            }
+            
+            x = parent;
+        }
+    }
+    
+    bool ConcurrentDisjointSet::merge(int x, int y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            
+            if (x == y) {
+                return false;
+            }
+            
+            if (precedes(y, x)) {
+                std::swap(x, y);
+            }
+            
+            // Fails if x stopped being a root, then retry.
+            int expected = x;
+            if (this->parents[x].compare_exchange_strong(expected, y,
+                    std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return true;
+            }
+        }
+    }
+    
+    bool ConcurrentDisjointSet::sameSet(int x, int y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            
+            if (x == y) {
+                return true;
+            }
+            
+            // If x is still a root, x and y were in distinct sets
+            // when y's root was found.
+            if (this->parents[x].load(std::memory_order_acquire) == x) {
+                return false;
+            }
+        }
+    }
+}
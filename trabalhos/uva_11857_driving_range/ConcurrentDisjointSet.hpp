@@ -0,0 +1,66 @@
+#ifndef CONCURRENT_DISJOINT_SET_HPP_
+#define CONCURRENT_DISJOINT_SET_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace disjointSet {
+    /**
+     * Lock-free union-find that many threads can update at once
+     * (Jayanti-Tarjan style). Parents are atomics changed only by
+     * compare-and-swap: merge links a root under another one, and find
+     * splits the path it walks. Roots are linked by a fixed pseudo
+     * random priority of the elements (a hash of the index), which
+     * can't form cycles and keeps the trees shallow without ranks.
+     * 
+     * find, merge and sameSet are linearizable.
+     */
+    class ConcurrentDisjointSet {
+    public:
+        /**
+         * Constructor with single parameter that puts every element
+         * in its own subset.
+         * 
+         * @param std::size_t The maximum number of subsets
+         */
+        explicit ConcurrentDisjointSet(std::size_t maxNumber);
+        
+        /**
+         * Finds the representive member of the set to which
+         * element x belongs, at some moment of the call.
+         * 
+         * @param int the element we are looking for
+         * @return int The representive member
+         */
+        int find(int x);
+        
+        /**
+         * Merges the sets to which x and y belong.
+         * 
+         * @param int one of the elements
+         * @param int the other element
+         * @return bool Whether this call merged two distinct sets
+         */
+        bool merge(int x, int y);
+        
+        /**
+         * Tells whether x and y belong to the same set.
+         * 
+         * @param int one of the elements
+         * @param int the other element
+         * @return bool Whether they are in the same set
+         */
+        bool sameSet(int x, int y);
+        
+    private:
+        /**
+         * Tells whether root x must be linked under root y.
+         */
+        bool precedes(int x, int y) const;
+        
+        std::vector<std::atomic<int>> parents;
+    };
+}
+
+#endif
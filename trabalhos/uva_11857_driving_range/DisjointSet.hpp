@@ -1,58 +1,313 @@
 #ifndef DISJOINT_SET_HPP_
 #define DISJOINT_SET_HPP_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace disjointSet {
-    /** 
-     * A structure to represent a subset for union-find.
+    /**
+     * How the roots of two trees are linked by merge.
      */
-    struct Subset {
-        int parent;
-        int rank;
+    enum Linking {
+        // The root of lower rank is attached to the other one.
+        BY_RANK,
+        // The root of the smaller set is attached to the other one.
+        BY_SIZE,
+        // The root of lower priority is attached to the other one,
+        // priorities being a fixed pseudo random permutation of the
+        // elements; needs no extra array.
+        BY_RANDOM_INDEX
     };
     
-    class DisjointSet {
+    /**
+     * How find shortens the path it walks.
+     */
+    enum Compression {
+        // Every visited element is pointed to the root (two passes).
+        FULL_COMPRESSION,
+        // Every other visited element is pointed to its grandparent.
+        PATH_HALVING,
+        // Every visited element is pointed to its grandparent.
+        PATH_SPLITTING,
+        // The path is left as it is.
+        NO_COMPRESSION
+    };
+    
+    /**
+     * Union-find over the elements 0..maxNumber-1.
+     * 
+     * Index is the integer type of the elements: a narrow type keeps
+     * the arrays compact for small inputs (unsigned short holds up to
+     * 65535 elements), a wide one allows large inputs. Parents, ranks
+     * and sizes live in separate arrays, so find only touches the
+     * parents. Sizes are kept when linking by size or when trackSizes
+     * is set, and so is the largest set; the number of sets is always
+     * kept.
+     * 
+     * Not thread-safe: every merge updates those counters, so a set
+     * must not be shared by threads, even if they touch disjoint
+     * elements (see ConcurrentDisjointSet for that).
+     */
+    template <typename Index, Linking linking = BY_RANK,
+              Compression compression = PATH_HALVING, bool trackSizes = false>
+    class BasicDisjointSet {
     public:
         /**
          * Constructor with single parameter that initializes
-         * the subset vector according with the maximum number
+         * the structure according with the maximum number
          * of subsets.
          * 
          * @param std::size_t The maximum number of subsets
          */
-        DisjointSet(std::size_t maxNumber);
-    
-         /**
+        explicit BasicDisjointSet(std::size_t maxNumber) {
+            reset(maxNumber);
+        }
+        
+        /**
+         * Puts every element back in its own subset, resizing the
+         * structure to the given number of subsets while keeping
+         * the memory already allocated.
+         * 
+         * @param std::size_t The maximum number of subsets
+         */
+        void reset(std::size_t maxNumber) {
+            this->parents.resize(maxNumber);
+            
+            for (std::size_t i = 0; i < maxNumber; i++) {
+                this->parents[i] = static_cast<Index>(i);
+            }
+            
+            if (linking == BY_RANK) {
+                this->ranks.assign(maxNumber, 0);
+            }
+            
+            if (HAS_SIZES) {
+                this->sizes.assign(maxNumber, 1);
+            }
+            
+            this->numComponents = maxNumber;
+            this->largest = 0;
+        }
+        
+        /**
          * Finds the representive member of the set to which
          * element x belongs, and may be x itself.
          * 
-         * Uses path compression as an optimization.
+         * Iterative, compressing the path as set by the
+         * compression parameter.
          * 
-         * @param int the element we are looking for
-         * @return int The representive member of the set to which
+         * @param Index the element we are looking for
+         * @return Index The representive member of the set to which
          * element x belongs.
          */
-        int find(int x);
+        Index find(Index x) {
+            std::vector<Index> &parents = this->parents;
+            
+            switch (compression) {
+            case FULL_COMPRESSION: {
+                Index root = x;
+                while (parents[root] != root) {
+                    root = parents[root];
+                }
+                
+                while (parents[x] != root) {
+                    Index next = parents[x];
+                    parents[x] = root;
+                    x = next;
+                }
+                
+                return root;
+            }
+            case PATH_HALVING:
+                while (parents[x] != x) {
+                    parents[x] = parents[parents[x]];
+                    x = parents[x];
+                }
+                
+                return x;
+            case PATH_SPLITTING:
+                while (parents[x] != x) {
+                    Index next = parents[x];
+                    parents[x] = parents[next];
+                    x = next;
+                }
+                
+                return x;
+            default:
+                while (parents[x] != x) {
+                    x = parents[x];
+                }
+                
+                return x;
+            }
+        }
         
         /**
          * Union function that uses find to determine the roots of
          * the trees x and y belong to. If the roots are distinct,
-         * the trees are combined by attaching the root of one to  
-         * the root of the other.
+         * the trees are combined by attaching the root of one to
+         * the root of the other, as set by the linking parameter.
          * 
-         * Uses union by rank as an optimization.
-         *
-         * @param int one of the elements that gonna has its subset
+         * @param Index one of the elements that gonna has its subset
          * merged.
-         * @param int the other element that gonna has its subset
+         * @param Index the other element that gonna has its subset
          * merged.
+         * @return Index The representive member of the merged set
+         */
+        Index merge(Index x, Index y) {
+            Index xRoot = find(x);
+            Index yRoot = find(y);
+            
+            if (xRoot == yRoot) {
+                return xRoot;
+            }
+            
+            if (linking == BY_RANK) {
+                if (this->ranks[xRoot] > this->ranks[yRoot]) {
+                    std::swap(xRoot, yRoot);
+                } else if (this->ranks[xRoot] == this->ranks[yRoot]) {
+                    this->ranks[yRoot]++;
+                }
+            } else if (linking == BY_SIZE) {
+                if (this->sizes[xRoot] > this->sizes[yRoot]) {
+                    std::swap(xRoot, yRoot);
+                }
+            } else if (priority(xRoot) > priority(yRoot)) {
+                std::swap(xRoot, yRoot);
+            }
+            
+            // xRoot goes under yRoot.
+            this->parents[xRoot] = yRoot;
+            
+            this->numComponents--;
+            
+            if (HAS_SIZES) {
+                this->sizes[yRoot] += this->sizes[xRoot];
+                
+                // Sets only grow, so the largest one is either still
+                // the largest or the one just merged.
+                if (this->largest == xRoot || this->sizes[yRoot] > this->sizes[this->largest]) {
+                    this->largest = yRoot;
+                }
+            }
+            
+            return yRoot;
+        }
+        
+        /**
+         * Merges many pairs at once. The pairs are rewritten in place:
+         * each one is put as (smaller, larger) and the range is sorted
+         * so that the unions walk the elements in order, then
+         * self-loops and repeated pairs are skipped. Requires sizes
+         * (linking by size or trackSizes).
+         * 
+         * @param RandomIt Begin of a range of std::pair<Index, Index>
+         * @param RandomIt End of the range
+         * @return std::size_t Size of the largest set after the batch
+         */
+        template <typename RandomIt>
+        std::size_t mergeBatch(RandomIt begin, RandomIt end) {
+            static_assert(HAS_SIZES, "set sizes are not tracked");
+            
+            for (RandomIt it = begin; it != end; ++it) {
+                if (it->second < it->first) {
+                    std::swap(it->first, it->second);
+                }
+            }
+            
+            std::sort(begin, end);
+            
+            for (RandomIt it = begin; it != end; ++it) {
+                if (it->first != it->second && (it == begin || *(it - 1) != *it)) {
+                    merge(it->first, it->second);
+                }
+            }
+            
+            return largestSize();
+        }
+        
+        /**
+         * Returns the number of elements of the set to which element
+         * x belongs. Requires sizes (linking by size or trackSizes).
+         * 
+         * @param Index the element
+         * @return std::size_t Size of its set
          */
-        void merge(int x, int y);
+        std::size_t size(Index x) {
+            static_assert(HAS_SIZES, "set sizes are not tracked");
+            
+            return this->sizes[find(x)];
+        }
+    
+        /**
+         * Returns the number of disjoint sets, in O(1). The elements
+         * are all connected when it's 1.
+         * 
+         * @return std::size_t Number of sets
+         */
+        std::size_t components() const {
+            return this->numComponents;
+        }
+        
+        /**
+         * Returns the number of elements of the largest set (0 if
+         * there are no elements), in O(1). Requires sizes (linking by
+         * size or trackSizes).
+         * 
+         * @return std::size_t Size of the largest set
+         */
+        std::size_t largestSize() const {
+            static_assert(HAS_SIZES, "set sizes are not tracked");
+            
+            return this->parents.empty() ? 0 : this->sizes[this->largest];
+        }
+        
+        /**
+         * Returns the representive member of the largest set, in O(1).
+         * Requires sizes (linking by size or trackSizes) and at least
+         * one element.
+         * 
+         * @return Index The representive member of the largest set
+         */
+        Index largestRoot() const {
+            static_assert(HAS_SIZES, "set sizes are not tracked");
+            
+            return this->largest;
+        }
         
     private:
-        std::vector<Subset> subsets;
+        static const bool HAS_SIZES = linking == BY_SIZE || trackSizes;
+        
+        /**
+         * Priority of an element for BY_RANDOM_INDEX (SplitMix64
+         * finalizer, a bijection, so priorities never tie).
+         */
+        static std::uint64_t priority(Index x) {
+            std::uint64_t h = static_cast<std::uint64_t>(x);
+            h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+            
+            return h ^ (h >> 31);
+        }
+        
+        std::vector<Index> parents;
+        std::vector<unsigned char> ranks;
+        std::vector<Index> sizes;
+        
+        std::size_t numComponents;
+        
+        // Root of the largest set, kept when sizes are.
+        Index largest;
     };
+    
+    /**
+     * The union-find used by the graph algorithms: int elements, union
+     * by rank and path halving.
+     */
+    typedef BasicDisjointSet<int> DisjointSet;
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,159 @@
+#include "DynamicConnectivity.hpp"
+#include "RollbackDisjointSet.hpp"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+namespace graph {
+    /**
+     * Segment tree over the timeline, holding in each node the edges
+     * alive during the whole node interval, as in CSR.
+     */
+    struct TimelineSolver {
+        const std::vector<Operation> &operations;
+        disjointSet::RollbackDisjointSet disjointSet;
+        
+        // Edges alive during [begin, end) of the timeline.
+        struct Interval {
+            int begin;
+            int end;
+            int x;
+            int y;
+        };
+        std::vector<Interval> intervals;
+        
+        std::vector<std::size_t> nodeOffsets;
+        std::vector<int> nodeEdges;
+        std::vector<bool> answers;
+        
+        TimelineSolver(std::size_t numVertices, const std::vector<Operation> &operations)
+                : operations(operations), disjointSet(numVertices) {}
+        
+        /**
+         * Calls visit(node, interval) for every node that the interval
+         * is split into.
+         */
+        template <typename Visit>
+        void split(int node, int nodeBegin, int nodeEnd, const Interval &interval, Visit &visit) {
+            if (interval.end <= nodeBegin || nodeEnd <= interval.begin) {
+                return;
+            }
+            
+            if (interval.begin <= nodeBegin && nodeEnd <= interval.end) {
+                visit(node);
+                return;
+            }
+            
+            int middle = (nodeBegin + nodeEnd) / 2;
+            split(2 * node, nodeBegin, middle, interval, visit);
+            split(2 * node + 1, middle, nodeEnd, interval, visit);
+        }
+        
+        void walk(int node, int nodeBegin, int nodeEnd) {
+            std::size_t snapshot = this->disjointSet.snapshot();
+            
+            for (std::size_t i = this->nodeOffsets[node]; i < this->nodeOffsets[node + 1]; i++) {
+                const Interval &interval = this->intervals[this->nodeEdges[i]];
+                this->disjointSet.merge(interval.x, interval.y);
+            }
+            
+            if (nodeEnd - nodeBegin == 1) {
+                const Operation &operation = this->operations[nodeBegin];
+                
+                if (operation.type == CONNECTED) {
+                    this->answers.push_back(this->disjointSet.find(operation.x) ==
+                                            this->disjointSet.find(operation.y));
+                } else if (operation.type == GRAPH_CONNECTED) {
+                    this->answers.push_back(this->disjointSet.components() <= 1);
+                }
+            } else {
+                int middle = (nodeBegin + nodeEnd) / 2;
+                walk(2 * node, nodeBegin, middle);
+                walk(2 * node + 1, middle, nodeEnd);
+            }
+            
+            this->disjointSet.rollback(snapshot);
+        }
+        
+        std::vector<bool> solve() {
+            const int numOperations = this->operations.size();
+            if (numOperations == 0) {
+                return this->answers;
+            }
+            
+            // Pairs the insertions and deletions of each edge. Parallel
+            // edges are independent: a deletion closes the most recent
+            // insertion still alive.
+            std::map<std::pair<int, int>, std::vector<int>> alive;
+            for (int t = 0; t < numOperations; t++) {
+                const Operation &operation = this->operations[t];
+                std::pair<int, int> edge = std::minmax(operation.x, operation.y);
+                
+                if (operation.type == ADD_EDGE) {
+                    alive[edge].push_back(t);
+                } else if (operation.type == REMOVE_EDGE) {
+                    std::map<std::pair<int, int>, std::vector<int>>::iterator it = alive.find(edge);
+                    
+                    if (it != alive.end() && !it->second.empty()) {
+                        Interval interval = {it->second.back(), t, edge.first, edge.second};
+                        this->intervals.push_back(interval);
+                        it->second.pop_back();
+                    }
+                }
+            }
+            
+            for (std::map<std::pair<int, int>, std::vector<int>>::iterator it = alive.begin();
+                    it != alive.end(); ++it) {
+                for (std::size_t i = 0; i < it->second.size(); i++) {
+                    Interval interval = {it->second[i], numOperations, it->first.first, it->first.second};
+                    this->intervals.push_back(interval);
+                }
+            }
+            
+            // Counts the edges of each node, then fills them in.
+            this->nodeOffsets.assign(4 * numOperations + 1, 0);
+            
+            struct Count {
+                std::vector<std::size_t> &offsets;
+                void operator()(int node) {
+                    this->offsets[node + 1]++;
+                }
+            } count = {this->nodeOffsets};
+            
+            for (std::size_t i = 0; i < this->intervals.size(); i++) {
+                split(1, 0, numOperations, this->intervals[i], count);
+            }
+            
+            for (std::size_t node = 1; node < this->nodeOffsets.size(); node++) {
+                this->nodeOffsets[node] += this->nodeOffsets[node - 1];
+            }
+            
+            std::vector<std::size_t> positions(this->nodeOffsets.begin(), this->nodeOffsets.end() - 1);
+            this->nodeEdges.resize(this->nodeOffsets.back());
+            
+            struct Fill {
+                std::vector<std::size_t> &positions;
+                std::vector<int> &nodeEdges;
+                int edge;
+                void operator()(int node) {
+                    this->nodeEdges[this->positions[node]++] = this->edge;
+                }
+            } fill = {positions, this->nodeEdges, 0};
+            
+            for (std::size_t i = 0; i < this->intervals.size(); i++) {
+                fill.edge = i;
+                split(1, 0, numOperations, this->intervals[i], fill);
+            }
+            
+            walk(1, 0, numOperations);
+            return this->answers;
+        }
+    };
+    
+    std::vector<bool> offlineConnectivity(std::size_t numVertices,
+                                          const std::vector<Operation> &operations) {
+        TimelineSolver solver(numVertices, operations);
+        return solver.solve();
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef DYNAMIC_CONNECTIVITY_HPP_
+#define DYNAMIC_CONNECTIVITY_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace graph {
+    /**
+     * Kind of an operation of a dynamic connectivity timeline.
+     */
+    enum OperationType {
+        // Adds an edge between x and y.
+        ADD_EDGE,
+        // Removes an edge between x and y (ignored if there is none).
+        REMOVE_EDGE,
+        // Asks whether x and y are connected.
+        CONNECTED,
+        // Asks whether the whole graph is connected (x and y unused).
+        GRAPH_CONNECTED
+    };
+    
+    /**
+     * Operation of a dynamic connectivity timeline, over an undirected
+     * graph.
+     */
+    struct Operation {
+        OperationType type;
+        int x;
+        int y;
+    };
+    
+    /**
+     * Answers offline the queries of a timeline of edge insertions and
+     * deletions. Each edge is alive during an interval of the timeline,
+     * which is split into O(log Q) nodes of a segment tree over time;
+     * a depth-first walk of the tree merges the edges of each node on
+     * a RollbackDisjointSet and undoes them on the way back, answering
+     * each query at its leaf. Runs in O(Q log Q log V).
+     * 
+     * @param std::size_t Number of vertices
+     * @param const std::vector<Operation>& The timeline
+     * @return std::vector<bool> The answers, one per query, in order
+     */
+    std::vector<bool> offlineConnectivity(std::size_t numVertices,
+                                          const std::vector<Operation> &operations);
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef EXTERNAL_KRUSKAL_HPP_
+#define EXTERNAL_KRUSKAL_HPP_
+
+#include "Graph.hpp"
+
+#include <cstddef>
+#include <istream>
+
+namespace graph {
+    /**
+     * Builds a minimum spanning tree using Kruskal's algorithm over
+     * an edge set that may not fit in memory. The edges are read from
+     * the input stream as "from to weight" triples and sorted in runs
+     * of at most bufferSize edges, which are spilled to a temporary
+     * file. The runs are then merged (k-way merge, at most
+     * min(bufferSize, 512) runs at a time, in as many passes as
+     * needed) and fed to a union-find that stays resident, so memory
+     * is bounded by the number of vertices plus the buffer, and only
+     * two temporary files are open at a time.
+     * 
+     * Each undirected edge must appear only once in the input. If the
+     * graph isn't connected, the result is a minimum spanning forest.
+     * Throws std::runtime_error if an edge can't be read or has a
+     * vertex out of range.
+     * 
+     * @param std::istream& Stream the edges are read from
+     * @param std::size_t Number of vertices
+     * @param std::size_t Number of edges to be read
+     * @param std::size_t Maximum number of edges kept in memory
+     * @return Graph that represents the minimum spanning tree
+     */
+    Graph externalKruskalMST(std::istream &input, std::size_t numVertices,
+                             std::size_t numEdges, std::size_t bufferSize);
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include "DisjointSet.hpp"
+#include "GraphBatch.hpp"
+#include "GraphBuilder.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace graph {
+    void GraphBatch::addCase(std::size_t numVertices, std::size_t numEdges) {
+        this->vertexOffsets.push_back(this->vertexOffsets.back() + numVertices);
+        this->edgeOffsets.push_back(this->edgeOffsets.back());
+        this->edges.reserve(this->edges.size() + numEdges);
+    }
+    
+    /**
+     * Solves a contiguous range of cases of a batch, with its own
+     * union-find over the vertices of those cases only. Different
+     * ranges touch disjoint parts of the edges and nothing else in
+     * common, so each thread gets its own solver.
+     */
+    struct BatchSolver {
+        GraphBatch &batch;
+        std::size_t firstCase;
+        std::size_t lastCase;
+        disjointSet::DisjointSet disjointSet;
+        std::vector<BatchResult> results;
+        
+        BatchSolver(GraphBatch &batch, std::size_t firstCase, std::size_t lastCase)
+                : batch(batch), firstCase(firstCase), lastCase(lastCase),
+                  disjointSet(batch.vertexOffsets[lastCase] - batch.vertexOffsets[firstCase]),
+                  results(lastCase - firstCase) {}
+        
+        void solve() {
+            const std::size_t firstVertex = this->batch.vertexOffsets[this->firstCase];
+            
+            for (std::size_t c = this->firstCase; c < this->lastCase; c++) {
+                const std::size_t vertexOffset = this->batch.vertexOffsets[c] - firstVertex;
+                const std::size_t numVertices = this->batch.vertexOffsets[c + 1] - this->batch.vertexOffsets[c];
+                
+                EdgeList::iterator begin =
+                    this->batch.edges.begin() + this->batch.edgeOffsets[c];
+                EdgeList::iterator end =
+                    this->batch.edges.begin() + this->batch.edgeOffsets[c + 1];
+                
+                // The duplicates are left past the new end of the case.
+                if (this->batch.collapseParallelEdges) {
+                    end = removeParallelEdges(begin, end, false);
+                }
+                
+                std::sort(begin, end);
+                
+                BatchResult &result = this->results[c - this->firstCase];
+                result.weight = 0;
+                result.bottleneck = 0;
+                
+                std::size_t numEdges = 0;
+                for (; begin != end && numEdges + 1 < numVertices; ++begin) {
+                    int srcRoot = this->disjointSet.find(vertexOffset + begin->second);
+                    int destRoot = this->disjointSet.find(vertexOffset + begin->first.second);
+                    
+                    if (srcRoot != destRoot) {
+                        this->disjointSet.merge(srcRoot, destRoot);
+                        result.weight += begin->first.first;
+                        result.bottleneck = begin->first.first;
+                        numEdges++;
+                    }
+                }
+                
+                result.isConnected = numEdges + 1 >= numVertices;
+            }
+        }
+    };
+    
+    std::vector<BatchResult> solveBatch(GraphBatch &batch, unsigned numThreads) {
+        const std::size_t numCases = batch.size();
+        numThreads = std::max(1u, std::min<unsigned>(numThreads, numCases));
+        
+        if (numThreads == 1) {
+            BatchSolver solver(batch, 0, numCases);
+            solver.solve();
+            return solver.results;
+        }
+        
+        // Contiguous ranges of cases with about the same number of edges.
+        const std::size_t totalEdges = batch.edgeOffsets.back();
+        std::vector<BatchSolver> solvers;
+        std::size_t firstCase = 0;
+        
+        for (unsigned t = 1; t <= numThreads && firstCase < numCases; t++) {
+            std::size_t lastCase = numCases;
+            
+            if (t < numThreads) {
+                std::size_t target = totalEdges / numThreads * t;
+                lastCase = std::upper_bound(batch.edgeOffsets.begin() + firstCase + 1,
+                                            batch.edgeOffsets.end() - 1, target)
+                         - batch.edgeOffsets.begin();
+            }
+            
+            solvers.push_back(BatchSolver(batch, firstCase, lastCase));
+            firstCase = lastCase;
+        }
+        
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < solvers.size(); i++) {
+            threads.push_back(std::thread(&BatchSolver::solve, &solvers[i]));
+        }
+        
+        std::vector<BatchResult> results;
+        results.reserve(numCases);
+        
+        for (std::size_t i = 0; i < threads.size(); i++) {
+            threads[i].join();
+            results.insert(results.end(), solvers[i].results.begin(), solvers[i].results.end());
+        }
+        
+        return results;
+    }
+}
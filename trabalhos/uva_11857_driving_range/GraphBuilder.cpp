@@ -0,0 +1,87 @@
+#include "GraphBuilder.hpp"
+
+#include <algorithm>
+
+namespace graph {
+    GraphBuilder::GraphBuilder(std::size_t size, bool isDirected, std::size_t numEdges,
+                               bool collapseParallelEdges)
+            : size(size), isDirected(isDirected),
+              collapseParallelEdges(collapseParallelEdges),
+              edgeFingerprint(size, isDirected) {
+        this->edges.reserve(numEdges);
+    }
+    
+    /**
+     * Orders edges by source vertex, then destination vertex, then
+     * weight, so that the lightest edge of each pair comes first.
+     */
+    static bool byEndpoints(const std::pair<Edge, int> &a, const std::pair<Edge, int> &b) {
+        if (a.second != b.second) {
+            return a.second < b.second;
+        }
+        
+        if (a.first.second != b.first.second) {
+            return a.first.second < b.first.second;
+        }
+        
+        return a.first.first < b.first.first;
+    }
+    
+    /**
+     * Whether both edges connect the same (ordered) pair of vertices.
+     */
+    static bool sameEndpoints(const std::pair<Edge, int> &a, const std::pair<Edge, int> &b) {
+        return a.second == b.second && a.first.second == b.first.second;
+    }
+    
+    EdgeList::iterator removeParallelEdges(EdgeList::iterator begin,
+                                           EdgeList::iterator end, bool isDirected) {
+        // An undirected edge is stored from its smaller vertex, so
+        // that both directions of a pair end up next to each other.
+        if (!isDirected) {
+            for (EdgeList::iterator edge = begin; edge != end; ++edge) {
+                if (edge->second > edge->first.second) {
+                    std::swap(edge->second, edge->first.second);
+                }
+            }
+        }
+        
+        std::sort(begin, end, byEndpoints);
+        return std::unique(begin, end, sameEndpoints);
+    }
+    
+    Graph GraphBuilder::build() {
+        if (this->collapseParallelEdges) {
+            this->edges.erase(
+                removeParallelEdges(this->edges.begin(), this->edges.end(), this->isDirected),
+                this->edges.end()
+            );
+        }
+        
+        const std::size_t numEdges = this->edges.size();
+        
+        // 1st pass: count the degree of every vertex.
+        std::vector<std::size_t> degrees(this->size, 0);
+        for (std::size_t i = 0; i < numEdges; i++) {
+            degrees[this->edges[i].second]++;
+            
+            if (!this->isDirected) {
+                degrees[this->edges[i].first.second]++;
+            }
+        }
+        
+        Graph graph(this->size, this->isDirected);
+        for (std::size_t i = 0; i < this->size; i++) {
+            graph[i].reserve(degrees[i]);
+        }
+        
+        // 2nd pass: fill the adjacency lists, which already have
+        // their exact capacity.
+        for (std::size_t i = 0; i < numEdges; i++) {
+            graph.appendEdge(this->edges[i].second, this->edges[i].first);
+        }
+        
+        EdgeList().swap(this->edges);
+        return graph;
+    }
+}
@@ -0,0 +1,59 @@
+#include "GraphFingerprint.hpp"
+
+#include <algorithm>
+
+namespace graph {
+    /**
+     * 64-bit mixing function (SplitMix64 finalizer).
+     */
+    static std::uint64_t mix(std::uint64_t x) {
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        
+        return x ^ (x >> 31);
+    }
+    
+    /**
+     * Independent 64-bit mixing function (MurmurHash3 finalizer), used
+     * by the check hash.
+     */
+    static std::uint64_t checkMix(std::uint64_t x) {
+        x = (x ^ (x >> 33)) * 0xFF51AFD7ED558CCDULL;
+        x = (x ^ (x >> 33)) * 0xC4CEB9FE1A85EC53ULL;
+        
+        return x ^ (x >> 33);
+    }
+    
+    void GraphFingerprint::appendEdge(int vertex, Edge edge) {
+        std::uint32_t from = vertex;
+        std::uint32_t to = edge.second;
+        
+        if (!this->isDirected && from > to) {
+            std::swap(from, to);
+        }
+        
+        const std::uint64_t key = (static_cast<std::uint64_t>(from) << 32) | to;
+        const std::uint32_t weight = edge.first;
+        
+        this->sum += mix(mix(key) ^ weight);
+        
+        // The check hash also squares each term, so that sums built
+        // to collide on the first hash don't collide on this one too.
+        std::uint64_t term = checkMix(checkMix(key ^ 0x9E3779B97F4A7C15ULL) + weight);
+        this->checkSum += term * (term | 1);
+        
+        this->numEdges++;
+    }
+    
+    Fingerprint GraphFingerprint::value() const {
+        std::uint64_t shape = mix(this->size * 2 + (this->isDirected ? 1 : 0));
+        
+        Fingerprint fingerprint;
+        fingerprint.hash = mix(this->sum ^ mix(shape + this->numEdges));
+        fingerprint.check = checkMix(this->checkSum ^ shape);
+        fingerprint.numVertices = this->size;
+        fingerprint.numEdges = this->numEdges;
+        
+        return fingerprint;
+    }
+}
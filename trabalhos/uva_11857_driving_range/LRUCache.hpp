@@ -0,0 +1,87 @@
+#ifndef LRU_CACHE_HPP_
+#define LRU_CACHE_HPP_
+
+#include "GraphFingerprint.hpp"
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace graph {
+    /**
+     * Cache of results keyed by graph fingerprint, which evicts the
+     * least recently used result once it's full. Entries are matched
+     * on the whole fingerprint, so a hit is verified by the check
+     * hash and the counts, and a collision of the hash alone is a
+     * miss.
+     */
+    template <typename Value>
+    class LRUCache {
+    public:
+        /**
+         * Constructor with single parameter that sets the capacity.
+         * 
+         * @param std::size_t Maximum number of cached results
+         */
+        explicit LRUCache(std::size_t capacity) : capacity(capacity) {}
+        
+        /**
+         * Looks a result up, marking it as the most recently used.
+         * 
+         * @param const Fingerprint& Fingerprint
+         * @param Value& Filled with the cached result, if any
+         * @return bool Whether the result was cached
+         */
+        bool get(const Fingerprint &key, Value &value) {
+            typename Index::iterator it = this->index.find(key);
+            if (it == this->index.end()) {
+                return false;
+            }
+            
+            this->entries.splice(this->entries.begin(), this->entries, it->second);
+            value = it->second->second;
+            return true;
+        }
+        
+        /**
+         * Caches a result, evicting the least recently used one if
+         * the cache is full.
+         * 
+         * @param const Fingerprint& Fingerprint
+         * @param const Value& Result
+         */
+        void put(const Fingerprint &key, const Value &value) {
+            typename Index::iterator it = this->index.find(key);
+            if (it != this->index.end()) {
+                it->second->second = value;
+                this->entries.splice(this->entries.begin(), this->entries, it->second);
+                return;
+            }
+            
+            if (this->capacity == 0) {
+                return;
+            }
+            
+            if (this->index.size() == this->capacity) {
+                this->index.erase(this->entries.back().first);
+                this->entries.pop_back();
+            }
+            
+            this->entries.push_front(std::make_pair(key, value));
+            this->index[key] = this->entries.begin();
+        }
+        
+    private:
+        typedef std::list<std::pair<Fingerprint, Value>> Entries;
+        typedef std::unordered_map<Fingerprint, typename Entries::iterator, FingerprintHash> Index;
+        
+        std::size_t capacity;
+        
+        // Most recently used first.
+        Entries entries;
+        Index index;
+    };
+}
+
+#endif
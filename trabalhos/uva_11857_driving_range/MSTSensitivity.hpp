@@ -0,0 +1,63 @@
+#ifndef MST_SENSITIVITY_HPP_
+#define MST_SENSITIVITY_HPP_
+
+#include "Graph.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace graph {
+    /**
+     * A structure to represent the sensitivity of a minimum spanning
+     * tree (or forest, if the graph isn't connected) to edge failures.
+     */
+    struct MSTSensitivity {
+        // Total weight of the minimum spanning tree.
+        long long mstWeight;
+        
+        // Edges of the minimum spanning tree, in the same layout used
+        // by Kruskal: the edge itself (weight and destination vertex)
+        // and its source vertex.
+        std::vector<std::pair<Edge, int>> treeEdges;
+        
+        // How much the weight of the tree rises if each tree edge
+        // fails (same indexes as treeEdges), or -1 if there's no
+        // replacement edge and its component gets disconnected.
+        std::vector<long long> replacementCost;
+        
+        // Whether there's another spanning tree (some non-tree edge).
+        bool hasSecondBest;
+        
+        // Weight of the second-best spanning tree, only meaningful if
+        // hasSecondBest is set (weights may be negative, so no value is
+        // left to mean none).
+        long long secondBestWeight;
+        
+        // Swap that yields the second-best spanning tree: the index of
+        // the removed tree edge (-1 if there's none) and the edge that
+        // replaces it.
+        int secondBestRemoved;
+        std::pair<Edge, int> secondBestAdded;
+    };
+    
+    /**
+     * Computes the replacement cost of every edge of the minimum
+     * spanning tree of an undirected graph and its second-best
+     * spanning tree, in O(E log V) total.
+     * 
+     * The tree is built with Kruskal's algorithm and indexed for
+     * lowest common ancestor queries with binary lifting, storing the
+     * heaviest edge of each jump. The second-best tree is the best swap
+     * of a non-tree edge with the heaviest tree edge on its cycle. The
+     * replacement of each tree edge is the lightest non-tree edge whose
+     * cycle covers it, found by processing non-tree edges in increasing
+     * weight order and skipping already covered tree paths with a
+     * union-find.
+     * 
+     * @param const Graph& Undirected graph
+     * @return MSTSensitivity Tree, replacement costs and second-best tree
+     */
+    MSTSensitivity mstSensitivity(const Graph &graph);
+}
+
+#endif
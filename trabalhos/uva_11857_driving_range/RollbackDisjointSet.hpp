@@ -0,0 +1,124 @@
+#ifndef ROLLBACK_DISJOINT_SET_HPP_
+#define ROLLBACK_DISJOINT_SET_HPP_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace disjointSet {
+    /**
+     * Union-find whose merges can be undone, most recent first. It
+     * uses union by rank and no path compression, so every merge
+     * changes a single parent (and maybe a rank) and find stays
+     * O(log n) without changing anything.
+     */
+    class RollbackDisjointSet {
+    public:
+        /**
+         * Constructor with single parameter that initializes
+         * the structure according with the maximum number
+         * of subsets.
+         * 
+         * @param std::size_t The maximum number of subsets
+         */
+        explicit RollbackDisjointSet(std::size_t maxNumber)
+                : parents(maxNumber), ranks(maxNumber, 0), numComponents(maxNumber) {
+            for (std::size_t i = 0; i < maxNumber; i++) {
+                this->parents[i] = i;
+            }
+        }
+        
+        /**
+         * Finds the representive member of the set to which
+         * element x belongs, and may be x itself.
+         * 
+         * @param int the element we are looking for
+         * @return int The representive member
+         */
+        int find(int x) const {
+            while (this->parents[x] != x) {
+                x = this->parents[x];
+            }
+            
+            return x;
+        }
+        
+        /**
+         * Merges the sets to which x and y belong, recording the
+         * change so that it can be undone.
+         * 
+         * @param int one of the elements
+         * @param int the other element
+         * @return bool Whether two distinct sets were merged
+         */
+        bool merge(int x, int y) {
+            int xRoot = find(x);
+            int yRoot = find(y);
+            
+            if (xRoot == yRoot) {
+                return false;
+            }
+            
+            if (this->ranks[xRoot] > this->ranks[yRoot]) {
+                std::swap(xRoot, yRoot);
+            }
+            
+            // xRoot goes under yRoot.
+            bool rankIncreased = this->ranks[xRoot] == this->ranks[yRoot];
+            this->parents[xRoot] = yRoot;
+            this->ranks[yRoot] += rankIncreased;
+            this->numComponents--;
+            
+            this->history.push_back(std::make_pair(xRoot, rankIncreased));
+            return true;
+        }
+        
+        /**
+         * Returns the current point of the history of merges.
+         * 
+         * @return std::size_t Number of merges not undone
+         */
+        std::size_t snapshot() const {
+            return this->history.size();
+        }
+        
+        /**
+         * Undoes the merges done after the given point of the
+         * history.
+         * 
+         * @param std::size_t Value returned by snapshot
+         */
+        void rollback(std::size_t snapshot) {
+            while (this->history.size() > snapshot) {
+                int xRoot = this->history.back().first;
+                int yRoot = this->parents[xRoot];
+                
+                this->ranks[yRoot] -= this->history.back().second;
+                this->parents[xRoot] = xRoot;
+                this->numComponents++;
+                
+                this->history.pop_back();
+            }
+        }
+        
+        /**
+         * Returns the number of disjoint sets.
+         * 
+         * @return std::size_t Number of sets
+         */
+        std::size_t components() const {
+            return this->numComponents;
+        }
+        
+    private:
+        std::vector<int> parents;
+        std::vector<unsigned char> ranks;
+        std::size_t numComponents;
+        
+        // Merges done: the root put under another one and whether the
+        // rank of the other one increased.
+        std::vector<std::pair<int, bool>> history;
+    };
+}
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef SPSC_QUEUE_HPP_
+#define SPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace graph {
+    /**
+     * Bounded lock-free queue for exactly one producer thread and one
+     * consumer thread (ring buffer with atomic head and tail indexes).
+     * 
+     * Items are swapped in and out instead of copied, so when T is a
+     * container the producer gets back the buffers already drained by
+     * the consumer and their memory is reused.
+     */
+    template <typename T>
+    class SPSCQueue {
+    public:
+        /**
+         * Constructor with single parameter that sets the capacity.
+         * 
+         * @param std::size_t Maximum number of items in the queue
+         */
+        explicit SPSCQueue(std::size_t capacity)
+                : slots(capacity + 1), head(0), tail(0) {}
+        
+        /**
+         * Swaps an item into the queue. Producer thread only.
+         * 
+         * @param T& Item to be pushed; receives a recycled item
+         * @return bool False if the queue is full
+         */
+        bool tryPush(T &item) {
+            const std::size_t tail = this->tail.load(std::memory_order_relaxed);
+            const std::size_t next = (tail + 1) % this->slots.size();
+            
+            if (next == this->head.load(std::memory_order_acquire)) {
+                return false;
+            }
+            
+            std::swap(this->slots[tail], item);
+            this->tail.store(next, std::memory_order_release);
+            return true;
+        }
+        
+        /**
+         * Swaps the oldest item out of the queue. Consumer thread only.
+         * 
+         * @param T& Receives the item; its previous value is left in
+         * the queue to be recycled by the producer
+         * @return bool False if the queue is empty
+         */
+        bool tryPop(T &item) {
+            const std::size_t head = this->head.load(std::memory_order_relaxed);
+            
+            if (head == this->tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            
+            std::swap(this->slots[head], item);
+            this->head.store((head + 1) % this->slots.size(), std::memory_order_release);
+            return true;
+        }
+        
+    private:
+        std::vector<T> slots;
+        
+        // Kept in different cache lines, since each one is written
+        // by a different thread.
+        alignas(64) std::atomic<std::size_t> head;
+        alignas(64) std::atomic<std::size_t> tail;
+    };
+}
+
+#endif
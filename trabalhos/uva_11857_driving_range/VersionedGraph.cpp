@@ -0,0 +1,78 @@
+#include "GraphAlgorithms.hpp"
+#include "VersionedGraph.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace graph {
+    bool GraphSnapshot::isConnected() const {
+        if (this->size() == 0) {
+            return true;
+        }
+        
+        LargeVector<bool> visited;
+        return breadthFirstSearch(*this, this->isDirected, 0, visited) == this->size();
+    }
+    
+    Graph GraphSnapshot::kruskalMST() const {
+        Graph mst(this->size(), false);
+        EdgeList edges;
+        disjointSet::DisjointSet disjointSet(0);
+        
+        kruskalSpanningTree(*this, mst, edges, disjointSet);
+        return mst;
+    }
+    
+    VersionedGraph::VersionedGraph(std::size_t size, bool isDirected)
+            : numVertices(size), isDirected(isDirected), nextVersion(0) {
+        const std::size_t numBlocks = (size + ADJACENCY_BLOCK_SIZE - 1) / ADJACENCY_BLOCK_SIZE;
+        
+        for (std::size_t i = 0; i < numBlocks; i++) {
+            std::size_t blockSize = std::min(ADJACENCY_BLOCK_SIZE, size - i * ADJACENCY_BLOCK_SIZE);
+            this->blocks.push_back(std::make_shared<AdjacencyBlock>(blockSize));
+        }
+        
+        this->copied.assign(numBlocks, false);
+        this->publish();
+    }
+    
+    AdjacentEdges &VersionedGraph::adjacentEdges(std::size_t vertex) {
+        const std::size_t block = vertex / ADJACENCY_BLOCK_SIZE;
+        
+        if (!this->copied[block]) {
+            this->blocks[block] = std::make_shared<AdjacencyBlock>(*this->blocks[block]);
+            this->copied[block] = true;
+        }
+        
+        return (*this->blocks[block])[vertex % ADJACENCY_BLOCK_SIZE];
+    }
+    
+    void VersionedGraph::appendEdge(int vertex, Edge edge) {
+        this->adjacentEdges(vertex).push_back(edge);
+        
+        if (!this->isDirected) {
+            this->adjacentEdges(edge.second)
+                .push_back(std::make_pair(edge.first, vertex));
+        }
+    }
+    
+    std::shared_ptr<const GraphSnapshot> VersionedGraph::publish() {
+        std::shared_ptr<GraphSnapshot> snapshot = std::make_shared<GraphSnapshot>();
+        snapshot->numVertices = this->numVertices;
+        snapshot->isDirected = this->isDirected;
+        snapshot->number = this->nextVersion++;
+        snapshot->blocks.assign(this->blocks.begin(), this->blocks.end());
+        
+        // From now on the blocks are shared with the snapshot, so the
+        // next change to each of them must copy it first.
+        this->copied.assign(this->copied.size(), false);
+        
+        std::shared_ptr<const GraphSnapshot> result = snapshot;
+        std::atomic_store(&this->published, result);
+        return result;
+    }
+    
+    std::shared_ptr<const GraphSnapshot> VersionedGraph::snapshot() const {
+        return std::atomic_load(&this->published);
+    }
+}
@@ -0,0 +1,101 @@
+#include "ConcurrentDisjointSet.hpp"
+#include "DisjointSet.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * Merges every pair with numThreads threads, each one taking an
+ * interleaved share of the pairs.
+ * 
+ * @return double Elapsed time in seconds
+ */
+static double run(const std::vector<std::pair<int, int>> &pairs, std::size_t size,
+                  unsigned numThreads, std::size_t &numMerges) {
+    disjointSet::ConcurrentDisjointSet set(size);
+    std::vector<std::size_t> merges(numThreads, 0);
+    std::vector<std::thread> threads;
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    for (unsigned t = 0; t < numThreads; t++) {
+        threads.push_back(std::thread([&, t]() {
+            std::size_t count = 0;
+            for (std::size_t i = t; i < pairs.size(); i += numThreads) {
+                count += set.merge(pairs[i].first, pairs[i].second);
+            }
+            
+            merges[t] = count;
+        }));
+    }
+    
+    for (unsigned t = 0; t < numThreads; t++) {
+        threads[t].join();
+    }
+    
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    numMerges = 0;
+    for (unsigned t = 0; t < numThreads; t++) {
+        numMerges += merges[t];
+    }
+    
+    return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t size = 1 << 22;
+    const std::size_t numPairs = argc > 1 ? std::strtoull(argv[1], NULL, 10) : 1 << 25;
+    
+    std::vector<std::pair<int, int>> pairs(numPairs);
+    std::uint64_t state = 88172645463325252ULL;
+    for (std::size_t i = 0; i < numPairs; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        
+        pairs[i] = std::make_pair(static_cast<int>((state & 0xFFFFFFFF) % size),
+                                  static_cast<int>((state >> 32) % size));
+    }
+    
+    // Sequential reference: the number of merges must match.
+    disjointSet::DisjointSet reference(size);
+    std::size_t expected = 0;
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < numPairs; i++) {
+        int xRoot = reference.find(pairs[i].first);
+        int yRoot = reference.find(pairs[i].second);
+        
+        if (xRoot != yRoot) {
+            reference.merge(xRoot, yRoot);
+            expected++;
+        }
+    }
+    
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("sequential DisjointSet: %.1f ns/op\n", elapsed * 1e9 / numPairs);
+    
+    std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    
+    double single = 0;
+    for (unsigned numThreads = 1; numThreads <= 64; numThreads *= 2) {
+        std::size_t numMerges;
+        elapsed = run(pairs, size, numThreads, numMerges);
+        
+        if (numThreads == 1) {
+            single = elapsed;
+        }
+        
+        std::printf("%2u threads: %6.1f ns/op, speedup %5.2f%s\n", numThreads,
+                    elapsed * 1e9 / numPairs, single / elapsed,
+                    numMerges == expected ? "" : " WRONG NUMBER OF MERGES");
+    }
+    
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include "DisjointSet.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * The previous union-find: recursive find with full path compression
+ * over an array of {parent, rank} subsets. Kept here as the baseline.
+ */
+class RecursiveDisjointSet {
+public:
+    RecursiveDisjointSet(std::size_t maxNumber) : subsets(maxNumber) {
+        for (std::size_t i = 0; i < maxNumber; i++) {
+            subsets[i].parent = i;
+            subsets[i].rank = 0;
+        }
+    }
+    
+    int find(int x) {
+        if (subsets[x].parent != x) {
+            subsets[x].parent = find(subsets[x].parent);
+        }
+        
+        return subsets[x].parent;
+    }
+    
+    void merge(int x, int y) {
+        int xRoot = find(x);
+        int yRoot = find(y);
+        
+        if (xRoot == yRoot) {
+            return;
+        }
+        
+        if (subsets[xRoot].rank < subsets[yRoot].rank) {
+            subsets[xRoot].parent = yRoot;
+        } else if (subsets[xRoot].rank > subsets[yRoot].rank) {
+            subsets[yRoot].parent = xRoot;
+        } else {
+            subsets[xRoot].parent = yRoot;
+            subsets[yRoot].rank++;
+        }
+    }
+    
+private:
+    struct Subset {
+        int parent;
+        int rank;
+    };
+    
+    std::vector<Subset> subsets;
+};
+
+/**
+ * Runs numOperations operations, half merges and half finds, on random
+ * elements. The sequence is the same for every structure.
+ * 
+ * @return double Elapsed time in seconds
+ */
+template <typename Set>
+static double run(std::size_t size, std::size_t numOperations) {
+    Set set(size);
+    std::uint64_t state = 88172645463325252ULL, checksum = 0;
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    for (std::size_t i = 0; i < numOperations; i++) {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        
+        int x = static_cast<int>((state & 0xFFFFFFFF) % size);
+        int y = static_cast<int>((state >> 32) % size);
+        
+        if (i & 1) {
+            checksum += set.find(x);
+        } else {
+            set.merge(x, y);
+        }
+    }
+    
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("    checksum %llu\n", static_cast<unsigned long long>(checksum));
+    
+    return elapsed;
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t size = 1 << 24;
+    const std::size_t numOperations = argc > 1 ? std::strtoull(argv[1], NULL, 10) : 100000000;
+    
+    std::printf("recursive find, {parent, rank} subsets:\n");
+    double elapsed = run<RecursiveDisjointSet>(size, numOperations);
+    std::printf("    %.1f ns/op\n", elapsed * 1e9 / numOperations);
+    
+    std::printf("iterative find with path halving, separate arrays:\n");
+    elapsed = run<disjointSet::DisjointSet>(size, numOperations);
+    std::printf("    %.1f ns/op\n", elapsed * 1e9 / numOperations);
+    
+    return 0;
+}
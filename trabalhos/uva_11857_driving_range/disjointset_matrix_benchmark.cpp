@@ -0,0 +1,216 @@
+#include "DisjointSet.hpp"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * A workload: pairs (x, y) are merges, pairs (x, -1) are finds.
+ */
+struct Workload {
+    std::string name;
+    std::size_t size;
+    std::vector<std::pair<int, int>> operations;
+};
+
+/**
+ * Hardware cache miss counter of this thread, if the kernel lets us
+ * open it.
+ */
+class CacheMisses {
+public:
+    CacheMisses() {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        
+        this->fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+    
+    ~CacheMisses() {
+        if (this->fd >= 0) {
+            close(this->fd);
+        }
+    }
+    
+    void start() {
+        if (this->fd >= 0) {
+            ioctl(this->fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(this->fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    
+    /**
+     * @return long long Misses since start, or -1 if unavailable
+     */
+    long long stop() {
+        long long count = -1;
+        
+        if (this->fd >= 0) {
+            ioctl(this->fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(this->fd, &count, sizeof(count)) != sizeof(count)) {
+                count = -1;
+            }
+        }
+        
+        return count;
+    }
+
+private:
+    int fd;
+};
+
+static std::uint64_t nextRandom(std::uint64_t &state) {
+    // xorshift64
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    
+    return state;
+}
+
+/**
+ * Random merges and finds, half each.
+ */
+static Workload randomWorkload(std::size_t size, std::size_t numOperations) {
+    Workload workload = {"random", size, std::vector<std::pair<int, int>>(numOperations)};
+    std::uint64_t state = 88172645463325252ULL;
+    
+    for (std::size_t i = 0; i < numOperations; i++) {
+        std::uint64_t r = nextRandom(state);
+        int x = static_cast<int>((r & 0xFFFFFFFF) % size);
+        int y = static_cast<int>((r >> 32) % size);
+        
+        workload.operations[i] = std::make_pair(x, i & 1 ? -1 : y);
+    }
+    
+    return workload;
+}
+
+/**
+ * Merges (i, i + 1) in order, which builds a chain unless linking
+ * balances the trees, then finds from random elements.
+ */
+static Workload chainWorkload(std::size_t size) {
+    Workload workload = {"adversarial chain", size, std::vector<std::pair<int, int>>()};
+    std::uint64_t state = 88172645463325252ULL;
+    
+    for (std::size_t i = 0; i + 1 < size; i++) {
+        workload.operations.push_back(std::make_pair(i, i + 1));
+    }
+    
+    for (std::size_t i = 0; i < size; i++) {
+        workload.operations.push_back(std::make_pair(nextRandom(state) % size, -1));
+    }
+    
+    return workload;
+}
+
+/**
+ * Friendship pairs from an input of uva_10608 (numbered from 1), every
+ * test on its own range of elements.
+ */
+static Workload friendshipWorkload(const char *path) {
+    Workload workload = {std::string("friendships ") + path, 0, std::vector<std::pair<int, int>>()};
+    std::ifstream input(path);
+    
+    std::size_t numTests = 0;
+    input >> numTests;
+    
+    for (std::size_t t = 0; t < numTests; t++) {
+        std::size_t numCitizens = 0, numPairs = 0;
+        input >> numCitizens >> numPairs;
+        
+        for (std::size_t i = 0; i < numPairs; i++) {
+            int x = 0, y = 0;
+            input >> x >> y;
+            workload.operations.push_back(std::make_pair(workload.size + x - 1,
+                                                         workload.size + y - 1));
+        }
+        
+        workload.size += numCitizens;
+    }
+    
+    return workload;
+}
+
+template <disjointSet::Linking linking, disjointSet::Compression compression>
+static void run(const Workload &workload, const char *name, CacheMisses &cacheMisses) {
+    disjointSet::BasicDisjointSet<int, linking, compression> set(workload.size);
+    const std::vector<std::pair<int, int>> &operations = workload.operations;
+    const std::size_t numOperations = operations.size();
+    std::uint64_t checksum = 0;
+    
+    cacheMisses.start();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    for (std::size_t i = 0; i < numOperations; i++) {
+        if (operations[i].second < 0) {
+            checksum += set.find(operations[i].first);
+        } else {
+            set.merge(operations[i].first, operations[i].second);
+        }
+    }
+    
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    long long misses = cacheMisses.stop();
+    
+    std::printf("    %-28s %8.1f ns/op", name, elapsed * 1e9 / numOperations);
+    if (misses >= 0) {
+        std::printf(" %8.3f misses/op", static_cast<double>(misses) / numOperations);
+    } else {
+        std::printf("      n/a misses/op");
+    }
+    std::printf("  (%zu sets, checksum %llu)\n", set.components(),
+                static_cast<unsigned long long>(checksum));
+}
+
+template <disjointSet::Linking linking>
+static void runCompressions(const Workload &workload, const char *name, CacheMisses &cacheMisses) {
+    const std::string prefix(name);
+    
+    run<linking, disjointSet::FULL_COMPRESSION>(workload, (prefix + " / full").c_str(), cacheMisses);
+    run<linking, disjointSet::PATH_HALVING>(workload, (prefix + " / halving").c_str(), cacheMisses);
+    run<linking, disjointSet::PATH_SPLITTING>(workload, (prefix + " / splitting").c_str(), cacheMisses);
+    run<linking, disjointSet::NO_COMPRESSION>(workload, (prefix + " / none").c_str(), cacheMisses);
+}
+
+int main(int argc, char *argv[]) {
+    std::vector<Workload> workloads;
+    workloads.push_back(randomWorkload(1 << 22, 1 << 25));
+    workloads.push_back(chainWorkload(1 << 22));
+    
+    // Real friendship graphs, given as uva_10608 inputs.
+    for (int i = 1; i < argc; i++) {
+        workloads.push_back(friendshipWorkload(argv[i]));
+    }
+    
+    CacheMisses cacheMisses;
+    
+    for (std::size_t w = 0; w < workloads.size(); w++) {
+        const Workload &workload = workloads[w];
+        std::printf("%s: %zu elements, %zu operations\n", workload.name.c_str(),
+                    workload.size, workload.operations.size());
+        
+        runCompressions<disjointSet::BY_RANK>(workload, "rank", cacheMisses);
+        runCompressions<disjointSet::BY_SIZE>(workload, "size", cacheMisses);
+        runCompressions<disjointSet::BY_RANDOM_INDEX>(workload, "random index", cacheMisses);
+    }
+    
+    return 0;
+}
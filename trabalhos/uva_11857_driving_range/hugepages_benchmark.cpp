@@ -0,0 +1,118 @@
+#include "HugePageAllocator.hpp"
+
+#include <sys/mman.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+/**
+ * Allocator that maps memory the kernel must not back with transparent
+ * huge pages (MADV_NOHUGEPAGE), so that the baseline really uses 4K
+ * pages even when THP is enabled for every mapping.
+ */
+template <typename T>
+class SmallPageAllocator {
+public:
+    typedef T value_type;
+    
+    SmallPageAllocator() {}
+    
+    template <typename U>
+    SmallPageAllocator(const SmallPageAllocator<U> &) {}
+    
+    T *allocate(std::size_t n) {
+        void *memory = mmap(NULL, n * sizeof(T), PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        
+        madvise(memory, n * sizeof(T), MADV_NOHUGEPAGE);
+        return static_cast<T *>(memory);
+    }
+    
+    void deallocate(T *memory, std::size_t n) {
+        munmap(memory, n * sizeof(T));
+    }
+};
+
+template <typename T, typename U>
+bool operator ==(const SmallPageAllocator<T> &, const SmallPageAllocator<U> &) {
+    return true;
+}
+
+template <typename T, typename U>
+bool operator !=(const SmallPageAllocator<T> &, const SmallPageAllocator<U> &) {
+    return false;
+}
+
+/**
+ * Prints how much of the process memory is backed by transparent
+ * huge pages.
+ */
+static void printHugePages() {
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    std::string line;
+    
+    while (std::getline(smaps, line)) {
+        if (line.find("AnonHugePages") != std::string::npos) {
+            std::printf("    %s\n", line.c_str());
+        }
+    }
+}
+
+/**
+ * Chases dependent random indexes through the array, the access pattern
+ * of union-find parents and of DFS/Prim over a large graph, where almost
+ * every load misses the TLB when the array lives on 4K pages.
+ * 
+ * @return double Elapsed time in seconds
+ */
+template <typename Array>
+static double chase(Array &array, std::size_t numLoads) {
+    const std::size_t size = array.size();
+    for (std::size_t i = 0; i < size; i++) {
+        array[i] = static_cast<std::uint32_t>((i * 2654435761u) & (size - 1));
+    }
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    std::uint64_t index = 0, checksum = 0;
+    for (std::size_t i = 0; i < numLoads; i++) {
+        index = (array[index] + i) & (size - 1);
+        checksum += index;
+    }
+    
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("    checksum %llu\n", static_cast<unsigned long long>(checksum));
+    printHugePages();
+    
+    return elapsed;
+}
+
+int main() {
+    // 512 MB of 32-bit indexes (size must be a power of two).
+    const std::size_t size = static_cast<std::size_t>(1) << 27;
+    const std::size_t numLoads = 20000000;
+    
+    {
+        std::vector<std::uint32_t, SmallPageAllocator<std::uint32_t>> array(size);
+        std::printf("4K pages:\n");
+        double elapsed = chase(array, numLoads);
+        std::printf("    %.1f ns/load\n", elapsed * 1e9 / numLoads);
+    }
+    
+    {
+        std::vector<std::uint32_t, graph::HugePageAllocator<std::uint32_t>> array(size);
+        std::printf("huge pages:\n");
+        double elapsed = chase(array, numLoads);
+        std::printf("    %.1f ns/load\n", elapsed * 1e9 / numLoads);
+    }
+    
+    return 0;
+}
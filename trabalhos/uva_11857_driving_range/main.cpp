@@ -1,49 +1,42 @@
-#include "Graph.hpp"
+#include "EdgePipeline.hpp"
+#include "GraphBatch.hpp"
 
 #include <iostream>
-#include <map>
-#include <queue>
-#include <string>
+#include <thread>
+#include <vector>
 
 int main() {
 	freopen("input.in", "r", stdin);
 	freopen("output.out", "w", stdout);
 	
+	// Every case is packed in a single batch, which is solved
+	// at once after the whole input has been read. Only the lightest
+	// road between two cities matters, so parallel roads are dropped.
+	graph::GraphBatch batch(true);
+	
 	int numCities, numRoads;
 	std::cin >> numCities >> numRoads;
 	
 	while (numCities != 0 || numRoads != 0) {
-    	graph::Graph graph(numCities, false);
+    	batch.addCase(numCities, numRoads);
     	
-    	for (int i = 0; i < numRoads; i++) {
-    	    int from, to;
-    	    int weight;
-    	    
-    	    std::cin >> from >> to >> weight;
-    	    graph.appendEdge(from, std::make_pair(weight, to));
-    	}
-		
-        if (graph.isConnected()) {
-    	   // graph::Graph mst = graph.primMST(cities[startStation]);
-			graph::Graph mst = graph.kruskalMST();
-			
-			int minCarRange = 0;
-			std::size_t mstSize = mst.size();
-			for (std::size_t i = 0; i < mstSize; i++) {
-				std::size_t numEdges = mst[i].size();
-
-				for (std::size_t j = 0; j < numEdges; j++) {
-					minCarRange = mst[i][j].first > minCarRange ? mst[i][j].first : minCarRange;
-				}
-			}
-
-			std::cout << minCarRange << std::endl;
-    	} else {
-    	    std::cout << "IMPOSSIBLE" << std::endl;
-    	}
+    	// Parsing runs on its own thread while the batch is filled.
+    	graph::pipelinedLoad(std::cin, numRoads, graph::IndexEdgeParser(), batch);
     
     	std::cin >> numCities >> numRoads;
 	}
 	
+	std::vector<graph::BatchResult> results =
+	    graph::solveBatch(batch, std::thread::hardware_concurrency());
+	const std::size_t numCases = results.size();
+	
+	for (std::size_t i = 0; i < numCases; i++) {
+        if (results[i].isConnected) {
+			std::cout << results[i].bottleneck << '\n';
+    	} else {
+    	    std::cout << "IMPOSSIBLE" << '\n';
+    	}
+	}
+	
 	return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,19 @@
+#include "MSTServer.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char *argv[]) {
+    std::ios::sync_with_stdio(false);
+    
+    // Optional limit of vertices and of edges of a loaded graph.
+    long long maxSize = graph::MSTServer::DEFAULT_MAX_SIZE;
+    if (argc > 1) {
+        maxSize = std::atoll(argv[1]);
+    }
+    
+    graph::MSTServer server(maxSize);
+    server.serve(std::cin, std::cout);
+    
+    return 0;
+}